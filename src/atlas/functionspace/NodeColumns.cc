@@ -28,6 +28,7 @@
 #include "atlas/parallel/Checksum.h"
 #include "atlas/parallel/GatherScatter.h"
 #include "atlas/parallel/HaloExchange.h"
+#include "atlas/parallel/detail/GatherFieldSet.h"
 #include "atlas/parallel/omp/omp.h"
 #include "atlas/runtime/Exception.h"
 #include "atlas/runtime/Trace.h"
@@ -43,30 +44,7 @@ namespace atlas {
 namespace functionspace {
 namespace detail {
 
-namespace {
-
-template <typename T, typename Field>
-array::LocalView<T, 3> make_leveled_view( Field& field ) {
-    using namespace array;
-    if ( field.levels() ) {
-        if ( field.variables() ) {
-            return make_view<T, 3>( field ).slice( Range::all(), Range::all(), Range::all() );
-        }
-        else {
-            return make_view<T, 2>( field ).slice( Range::all(), Range::all(), Range::dummy() );
-        }
-    }
-    else {
-        if ( field.variables() ) {
-            return make_view<T, 2>( field ).slice( Range::all(), Range::dummy(), Range::all() );
-        }
-        else {
-            return make_view<T, 1>( field ).slice( Range::all(), Range::dummy(), Range::dummy() );
-        }
-    }
-}
-
-}  // namespace
+using parallel::detail::make_leveled_view;
 
 class NodeColumnsHaloExchangeCache : public util::Cache<std::string, parallel::HaloExchange>,
                                      public mesh::detail::MeshObserver {
@@ -362,6 +340,19 @@ void dispatch_haloExchange( Field& field, const parallel::HaloExchange& halo_exc
 }  // namespace
 
 void NodeColumns::haloExchange( const FieldSet& fieldset, bool on_device ) const {
+    if ( fieldset.size() > 1 && !on_device ) {
+        // Fused exchange: one message per partner task for all fields
+        std::vector<array::Array*> arrays;
+        arrays.reserve( fieldset.size() );
+        for ( idx_t f = 0; f < fieldset.size(); ++f ) {
+            arrays.push_back( &const_cast<FieldSet&>( fieldset )[f].array() );
+        }
+        halo_exchange().execute( arrays );
+        for ( idx_t f = 0; f < fieldset.size(); ++f ) {
+            const_cast<FieldSet&>( fieldset )[f].set_dirty( false );
+        }
+        return;
+    }
     for ( idx_t f = 0; f < fieldset.size(); ++f ) {
         Field& field = const_cast<FieldSet&>( fieldset )[f];
         switch ( field.rank() ) {
@@ -397,39 +388,7 @@ const parallel::HaloExchange& NodeColumns::halo_exchange() const {
 }
 
 void NodeColumns::gather( const FieldSet& local_fieldset, FieldSet& global_fieldset ) const {
-    ATLAS_ASSERT( local_fieldset.size() == global_fieldset.size() );
-
-    for ( idx_t f = 0; f < local_fieldset.size(); ++f ) {
-        const Field& loc      = local_fieldset[f];
-        Field& glb            = global_fieldset[f];
-        const idx_t nb_fields = 1;
-        idx_t root( 0 );
-        glb.metadata().get( "owner", root );
-
-        if ( loc.datatype() == array::DataType::kind<int>() ) {
-            parallel::Field<int const> loc_field( make_leveled_view<const int>( loc ) );
-            parallel::Field<int> glb_field( make_leveled_view<int>( glb ) );
-            gather().gather( &loc_field, &glb_field, nb_fields, root );
-        }
-        else if ( loc.datatype() == array::DataType::kind<long>() ) {
-            parallel::Field<long const> loc_field( make_leveled_view<const long>( loc ) );
-            parallel::Field<long> glb_field( make_leveled_view<long>( glb ) );
-            gather().gather( &loc_field, &glb_field, nb_fields, root );
-        }
-        else if ( loc.datatype() == array::DataType::kind<float>() ) {
-            parallel::Field<float const> loc_field( make_leveled_view<const float>( loc ) );
-            parallel::Field<float> glb_field( make_leveled_view<float>( glb ) );
-            gather().gather( &loc_field, &glb_field, nb_fields, root );
-        }
-        else if ( loc.datatype() == array::DataType::kind<double>() ) {
-            parallel::Field<double const> loc_field( make_leveled_view<const double>( loc ) );
-            parallel::Field<double> glb_field( make_leveled_view<double>( glb ) );
-            gather().gather( &loc_field, &glb_field, nb_fields, root );
-        }
-        else {
-            throw_Exception( "datatype not supported", Here() );
-        }
-    }
+    parallel::detail::gather_fieldset( gather(), local_fieldset, global_fieldset );
 }
 
 void NodeColumns::gather( const Field& local, Field& global ) const {
@@ -487,6 +487,10 @@ public:
     void haloExchange( const Field&, bool on_device = false ) const;
     const parallel::HaloExchange& halo_exchange() const;
 
+    /// @brief Gather every field of the FieldSet on the task that owns its global field
+    ///
+    /// The owner is set when creating the global field with option::global( owner ), e.g. round-robin over
+    /// the tasks for parallel output. The gathers of all fields are posted concurrently.
     void gather( const FieldSet&, FieldSet& ) const;
     void gather( const Field&, Field& ) const;
     const parallel::GatherScatter& gather() const;
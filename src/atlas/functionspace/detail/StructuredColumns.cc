@@ -31,6 +31,7 @@
 #include "atlas/parallel/Checksum.h"
 #include "atlas/parallel/GatherScatter.h"
 #include "atlas/parallel/HaloExchange.h"
+#include "atlas/parallel/detail/GatherFieldSet.h"
 #include "atlas/parallel/mpi/mpi.h"
 #include "atlas/parallel/omp/fill.h"
 #include "atlas/parallel/omp/omp.h"
@@ -49,26 +50,7 @@ namespace detail {
 namespace {
 
 
-template <typename T, typename Field>
-array::LocalView<T, 3> make_leveled_view( Field& field ) {
-    using namespace array;
-    if ( field.levels() ) {
-        if ( field.variables() ) {
-            return make_view<T, 3>( field ).slice( Range::all(), Range::all(), Range::all() );
-        }
-        else {
-            return make_view<T, 2>( field ).slice( Range::all(), Range::all(), Range::dummy() );
-        }
-    }
-    else {
-        if ( field.variables() ) {
-            return make_view<T, 2>( field ).slice( Range::all(), Range::dummy(), Range::all() );
-        }
-        else {
-            return make_view<T, 1>( field ).slice( Range::all(), Range::dummy(), Range::dummy() );
-        }
-    }
-}
+using parallel::detail::make_leveled_view;
 
 template <typename T>
 std::string checksum_3d_field( const parallel::Checksum& checksum, const Field& field ) {
@@ -530,39 +512,7 @@ Field StructuredColumns::createField( const Field& other, const eckit::Configura
 // Gather FieldSet
 // ----------------------------------------------------------------------------
 void StructuredColumns::gather( const FieldSet& local_fieldset, FieldSet& global_fieldset ) const {
-    ATLAS_ASSERT( local_fieldset.size() == global_fieldset.size() );
-
-    for ( idx_t f = 0; f < local_fieldset.size(); ++f ) {
-        const Field& loc      = local_fieldset[f];
-        Field& glb            = global_fieldset[f];
-        const idx_t nb_fields = 1;
-        idx_t root( 0 );
-        glb.metadata().get( "owner", root );
-
-        if ( loc.datatype() == array::DataType::kind<int>() ) {
-            parallel::Field<int const> loc_field( make_leveled_view<const int>( loc ) );
-            parallel::Field<int> glb_field( make_leveled_view<int>( glb ) );
-            gather().gather( &loc_field, &glb_field, nb_fields, root );
-        }
-        else if ( loc.datatype() == array::DataType::kind<long>() ) {
-            parallel::Field<long const> loc_field( make_leveled_view<const long>( loc ) );
-            parallel::Field<long> glb_field( make_leveled_view<long>( glb ) );
-            gather().gather( &loc_field, &glb_field, nb_fields, root );
-        }
-        else if ( loc.datatype() == array::DataType::kind<float>() ) {
-            parallel::Field<float const> loc_field( make_leveled_view<const float>( loc ) );
-            parallel::Field<float> glb_field( make_leveled_view<float>( glb ) );
-            gather().gather( &loc_field, &glb_field, nb_fields, root );
-        }
-        else if ( loc.datatype() == array::DataType::kind<double>() ) {
-            parallel::Field<double const> loc_field( make_leveled_view<const double>( loc ) );
-            parallel::Field<double> glb_field( make_leveled_view<double>( glb ) );
-            gather().gather( &loc_field, &glb_field, nb_fields, root );
-        }
-        else {
-            throw_Exception( "datatype not supported", Here() );
-        }
-    }
+    parallel::detail::gather_fieldset( gather(), local_fieldset, global_fieldset );
 }
 // ----------------------------------------------------------------------------
 
@@ -743,23 +693,34 @@ struct FixupHaloForVectors<3> {
 };
 
 
+/// @param exchanged  halos of the field were already exchanged with other fields (fused exchange), and only need
+///                   to be fixed up
 template <int RANK>
-void dispatch_haloExchange( Field& field, const parallel::HaloExchange& halo_exchange, const StructuredColumns& fs ) {
+void dispatch_haloExchange( Field& field, const parallel::HaloExchange& halo_exchange, const StructuredColumns& fs,
+                            bool exchanged = false ) {
     FixupHaloForVectors<RANK> fixup_halos( fs );
     if ( field.datatype() == array::DataType::kind<int>() ) {
-        halo_exchange.template execute<int, RANK>( field.array(), false );
+        if ( not exchanged ) {
+            halo_exchange.template execute<int, RANK>( field.array(), false );
+        }
         fixup_halos.template apply<int>( field );
     }
     else if ( field.datatype() == array::DataType::kind<long>() ) {
-        halo_exchange.template execute<long, RANK>( field.array(), false );
+        if ( not exchanged ) {
+            halo_exchange.template execute<long, RANK>( field.array(), false );
+        }
         fixup_halos.template apply<long>( field );
     }
     else if ( field.datatype() == array::DataType::kind<float>() ) {
-        halo_exchange.template execute<float, RANK>( field.array(), false );
+        if ( not exchanged ) {
+            halo_exchange.template execute<float, RANK>( field.array(), false );
+        }
         fixup_halos.template apply<float>( field );
     }
     else if ( field.datatype() == array::DataType::kind<double>() ) {
-        halo_exchange.template execute<double, RANK>( field.array(), false );
+        if ( not exchanged ) {
+            halo_exchange.template execute<double, RANK>( field.array(), false );
+        }
         fixup_halos.template apply<double>( field );
     }
     else {
@@ -797,20 +758,30 @@ void dispatch_adjointHaloExchange( Field& field, const parallel::HaloExchange& h
 }  // namespace
 
 void StructuredColumns::haloExchange( const FieldSet& fieldset, bool ) const {
+    const bool fused = fieldset.size() > 1;
+    if ( fused ) {
+        // Fused exchange: one message per partner task for all fields
+        std::vector<array::Array*> arrays;
+        arrays.reserve( fieldset.size() );
+        for ( idx_t f = 0; f < fieldset.size(); ++f ) {
+            arrays.push_back( &const_cast<FieldSet&>( fieldset )[f].array() );
+        }
+        halo_exchange().execute( arrays );
+    }
     for ( idx_t f = 0; f < fieldset.size(); ++f ) {
         Field& field = const_cast<FieldSet&>( fieldset )[f];
         switch ( field.rank() ) {
             case 1:
-                dispatch_haloExchange<1>( field, halo_exchange(), *this );
+                dispatch_haloExchange<1>( field, halo_exchange(), *this, fused );
                 break;
             case 2:
-                dispatch_haloExchange<2>( field, halo_exchange(), *this );
+                dispatch_haloExchange<2>( field, halo_exchange(), *this, fused );
                 break;
             case 3:
-                dispatch_haloExchange<3>( field, halo_exchange(), *this );
+                dispatch_haloExchange<3>( field, halo_exchange(), *this, fused );
                 break;
             case 4:
-                dispatch_haloExchange<4>( field, halo_exchange(), *this );
+                dispatch_haloExchange<4>( field, halo_exchange(), *this, fused );
                 break;
             default:
                 throw_Exception( "Rank not supported", Here() );
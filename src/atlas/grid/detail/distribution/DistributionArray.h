@@ -39,6 +39,9 @@ public:
 
     DistributionArray( int nb_partitions, partition_t&& partition );
 
+    /// @brief Construct from the partition array that the partitioner computed
+    DistributionArray( const Partitioner&, partition_t&& partition );
+
     virtual ~DistributionArray();
 
     int partition( const gidx_t gidx ) const override { return part_[gidx]; }
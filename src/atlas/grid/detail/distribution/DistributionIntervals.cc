@@ -0,0 +1,168 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include "DistributionIntervals.h"
+
+#include <algorithm>
+#include <ostream>
+#include <set>
+
+#include "eckit/types/Types.h"
+#include "eckit/utils/Hash.h"
+
+#include "atlas/grid/Grid.h"
+#include "atlas/grid/Partitioner.h"
+#include "atlas/runtime/Trace.h"
+#include "atlas/util/vector.h"
+
+namespace atlas {
+namespace grid {
+namespace detail {
+namespace distribution {
+
+namespace {
+std::string distribution_type( int N, const Partitioner& p = Partitioner() ) {
+    if ( N == 1 ) {
+        return "serial";
+    }
+    if ( not p ) {
+        return "custom";
+    }
+    return p.type();
+}
+}  // namespace
+
+DistributionIntervals::DistributionIntervals( const Grid& grid, const Partitioner& partitioner ) {
+    nb_partitions_ = partitioner.nb_partitions();
+    {
+        // Generic partitioners can only fill a complete partition array, of which only the intervals are kept.
+        // The equal_regions and checkerboard partitioners compute their intervals directly instead
+        atlas::vector<int> part( grid.size() );
+        partitioner.partition( grid, part.data() );
+        setup( part.data(), part.size(), 0 );
+    }
+    type_ = distribution_type( nb_partitions_, partitioner );
+}
+
+DistributionIntervals::DistributionIntervals( const Partitioner& partitioner, const int part[], gidx_t size ) {
+    nb_partitions_ = partitioner.nb_partitions();
+    setup( part, size, 0 );
+    type_ = distribution_type( nb_partitions_, partitioner );
+}
+
+DistributionIntervals::DistributionIntervals( int nb_partitions, idx_t npts, const int part[], int part0 ) {
+    if ( nb_partitions == 0 ) {
+        std::set<int> partset( part, part + npts );
+        nb_partitions_ = static_cast<idx_t>( partset.size() );
+    }
+    else {
+        nb_partitions_ = nb_partitions;
+    }
+    setup( part, npts, part0 );
+    type_ = distribution_type( nb_partitions_ );
+}
+
+DistributionIntervals::DistributionIntervals( int nb_partitions, std::vector<gidx_t>&& begin, std::vector<int>&& part,
+                                              const std::string& type ) :
+    nb_partitions_( nb_partitions ), begin_( std::move( begin ) ), part_( std::move( part ) ), type_( type ) {
+    ATLAS_ASSERT( begin_.size() == part_.size() + 1 );
+    begin_.shrink_to_fit();
+    part_.shrink_to_fit();
+    setup_nb_pts();
+    if ( nb_partitions_ == 1 ) {
+        type_ = distribution_type( nb_partitions_ );
+    }
+}
+
+DistributionIntervals::~DistributionIntervals() = default;
+
+void DistributionIntervals::setup( const int part[], gidx_t size, int part0 ) {
+    ATLAS_TRACE( "DistributionIntervals::setup" );
+    begin_.clear();
+    part_.clear();
+    for ( gidx_t n = 0; n < size; ++n ) {
+        const int p = part[n] - part0;
+        if ( part_.empty() || p != part_.back() ) {
+            begin_.emplace_back( n );
+            part_.emplace_back( p );
+        }
+    }
+    begin_.emplace_back( size );
+    begin_.shrink_to_fit();
+    part_.shrink_to_fit();
+    setup_nb_pts();
+}
+
+size_t DistributionIntervals::count_intervals( const int part[], gidx_t size ) {
+    size_t nb_intervals = size > 0 ? 1 : 0;
+    for ( gidx_t n = 1; n < size; ++n ) {
+        if ( part[n] != part[n - 1] ) {
+            ++nb_intervals;
+        }
+    }
+    return nb_intervals;
+}
+
+void DistributionIntervals::setup_nb_pts() {
+    nb_pts_.assign( nb_partitions_, 0 );
+    for ( size_t j = 0; j < part_.size(); ++j ) {
+        ATLAS_ASSERT( part_[j] >= 0 && part_[j] < nb_partitions_ );
+        nb_pts_[part_[j]] += static_cast<idx_t>( begin_[j + 1] - begin_[j] );
+    }
+    if ( nb_pts_.empty() ) {
+        max_pts_ = 0;
+        min_pts_ = 0;
+        return;
+    }
+    max_pts_ = *std::max_element( nb_pts_.begin(), nb_pts_.end() );
+    min_pts_ = *std::min_element( nb_pts_.begin(), nb_pts_.end() );
+}
+
+void DistributionIntervals::partition( gidx_t begin, gidx_t end, int partitions[] ) const {
+    if ( begin >= end ) {
+        return;
+    }
+    ATLAS_ASSERT( begin >= 0 && end <= size() );
+    size_t i = 0;
+    for ( size_t j = interval( begin ); begin < end; ++j ) {
+        const gidx_t interval_end = std::min( begin_[j + 1], end );
+        std::fill( partitions + i, partitions + i + ( interval_end - begin ), part_[j] );
+        i += interval_end - begin;
+        begin = interval_end;
+    }
+}
+
+void DistributionIntervals::print( std::ostream& s ) const {
+    auto print_partition = [&]( std::ostream& s ) {
+        eckit::output_list<int> list_printer( s );
+        for ( size_t j = 0; j < part_.size(); ++j ) {
+            for ( gidx_t n = begin_[j]; n < begin_[j + 1]; ++n ) {
+                list_printer.push_back( part_[j] );
+            }
+        }
+    };
+    s << "Distribution( "
+      << "type: " << type_ << ", nb_points: " << size() << ", nb_partitions: " << nb_pts_.size()
+      << ", nb_intervals: " << nb_intervals() << ", parts : ";
+    print_partition( s );
+}
+
+void DistributionIntervals::hash( eckit::Hash& hash ) const {
+    for ( size_t j = 0; j < part_.size(); ++j ) {
+        hash.add( begin_[j] );
+        hash.add( part_[j] );
+    }
+    hash.add( size() );
+}
+
+}  // namespace distribution
+}  // namespace detail
+}  // namespace grid
+}  // namespace atlas
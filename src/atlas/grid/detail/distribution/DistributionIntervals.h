@@ -0,0 +1,109 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "atlas/grid/detail/distribution/DistributionImpl.h"
+#include "atlas/runtime/Exception.h"
+
+namespace atlas {
+namespace grid {
+class Partitioner;
+
+namespace detail {
+namespace distribution {
+
+/// @brief Distribution stored as intervals of consecutive global indices that belong to the same partition
+///
+/// Partitioners of structured grids assign contiguous ranges of points on every latitude to a partition,
+/// so that the number of intervals scales with the number of latitudes and partitions, and not with the
+/// number of grid points as for DistributionArray.
+/// Lookup of a single global index is a binary search over the intervals, so that loops over many consecutive
+/// global indices should rather use the bulk partition( begin, end, partitions ).
+class DistributionIntervals : public DistributionImpl {
+public:
+    DistributionIntervals( const Grid&, const Partitioner& );
+
+    /// @brief Construct from the partition array that the partitioner computed for a grid of given size
+    DistributionIntervals( const Partitioner&, const int partition[], gidx_t size );
+
+    DistributionIntervals( int nb_partitions, idx_t npts, const int partition[], int part0 = 0 );
+
+    /// @brief Construct from intervals: begin holds the first global index of every interval followed by the
+    /// total number of points, and part holds the partition of every interval
+    DistributionIntervals( int nb_partitions, std::vector<gidx_t>&& begin, std::vector<int>&& part,
+                           const std::string& type );
+
+    virtual ~DistributionIntervals();
+
+    int partition( const gidx_t gidx ) const override {
+#ifndef NDEBUG
+        ATLAS_ASSERT( gidx >= 0 && gidx < size() );
+#endif
+        return part_[interval( gidx )];
+    }
+
+    void partition( gidx_t begin, gidx_t end, int partitions[] ) const override;
+
+    idx_t nb_partitions() const override { return nb_partitions_; }
+
+    const std::vector<idx_t>& nb_pts() const override { return nb_pts_; }
+
+    idx_t max_pts() const override { return max_pts_; }
+    idx_t min_pts() const override { return min_pts_; }
+
+    const std::string& type() const override { return type_; }
+
+    void print( std::ostream& ) const override;
+
+    size_t footprint() const override {
+        return nb_pts_.size() * sizeof( nb_pts_[0] ) + begin_.size() * sizeof( begin_[0] ) +
+               part_.size() * sizeof( part_[0] );
+    }
+
+    bool functional() const override { return false; }
+
+    gidx_t size() const override { return begin_.back(); }
+
+    void hash( eckit::Hash& ) const override;
+
+    /// @brief Number of intervals of consecutive global indices with equal partition
+    size_t nb_intervals() const { return part_.size(); }
+
+    /// @brief Number of intervals of consecutive global indices with equal partition in a partition array
+    static size_t count_intervals( const int partition[], gidx_t size );
+
+private:
+    void setup( const int partition[], gidx_t size, int part0 );
+
+    void setup_nb_pts();
+
+    size_t interval( gidx_t gidx ) const {
+        return static_cast<size_t>( std::upper_bound( begin_.begin(), begin_.end(), gidx ) - begin_.begin() ) - 1;
+    }
+
+    idx_t nb_partitions_ = 0;
+
+    std::vector<gidx_t> begin_;  // First global index of each interval, followed by size()
+    std::vector<int> part_;      // Partition of each interval
+    std::vector<idx_t> nb_pts_;
+    idx_t max_pts_;
+    idx_t min_pts_;
+    std::string type_;
+};
+
+}  // namespace distribution
+}  // namespace detail
+}  // namespace grid
+}  // namespace atlas
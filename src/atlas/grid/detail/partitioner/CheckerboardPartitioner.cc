@@ -19,9 +19,12 @@
 #include <vector>
 
 
+#include "atlas/grid/Distribution.h"
 #include "atlas/grid/StructuredGrid.h"
+#include "atlas/grid/detail/distribution/DistributionIntervals.h"
 #include "atlas/runtime/Exception.h"
 #include "atlas/runtime/Log.h"
+#include "atlas/runtime/Trace.h"
 #include "atlas/util/MicroDeg.h"
 
 using atlas::util::microdeg;
@@ -110,24 +113,18 @@ bool compare_X_Y( const CheckerboardPartitioner::NodeInt& node1, const Checkerbo
     return false;
 }
 
-void CheckerboardPartitioner::partition( const Checkerboard& cb, int nb_nodes, NodeInt nodes[], int part[] ) const {
+void CheckerboardPartitioner::sizes( const Checkerboard& cb, size_t nb_nodes, std::vector<size_t>& ngpb,
+                                     std::vector<size_t>& npartsb, std::vector<size_t>& count ) const {
     size_t nparts = nb_partitions();
     size_t nbands = cb.nbands;
     size_t nx     = cb.nx;
     size_t ny     = cb.ny;
     long remainder;
 
-    /*
-Sort nodes from south to north (increasing y), and west to east (increasing x).
-Now we can easily split
-the points in bands. Note this may not be necessary, as it could be
-already by construction in this order, but then sorting is really fast
-*/
-
     /*
 Number of procs per band
 */
-    std::vector<size_t> npartsb( nbands, 0 );  // number of procs per band
+    npartsb.assign( nbands, 0 );  // number of procs per band
     remainder = nparts;
     for ( size_t iband = 0; iband < nbands; iband++ ) {
         npartsb[iband] = nparts / nbands;
@@ -143,7 +140,7 @@ Number of procs per band
     /*
 Number of gridpoints per band
 */
-    std::vector<size_t> ngpb( nbands, 0 );
+    ngpb.assign( nbands, 0 );
     // split latitudes?
     if ( split_lats ) {
         remainder = nb_nodes;
@@ -168,17 +165,9 @@ Number of gridpoints per band
         }
     }
 
-    // sort nodes according to Y first, to determine bands
-    std::sort( nodes, nodes + nb_nodes, compare_Y_X );
-
-    // for each band, select gridpoints belonging to that band, and sort them
-    // according to X first
-    size_t offset = 0;
-    int jpart     = 0;
+    count.clear();
+    count.reserve( nparts );
     for ( size_t iband = 0; iband < nbands; iband++ ) {
-        // sort according to X first
-        std::sort( nodes + offset, nodes + offset + ngpb[iband], compare_X_Y );
-
         // number of gridpoints per task
         std::vector<int> ngpp( npartsb[iband], 0 );
         remainder = ngpb[iband];
@@ -209,13 +198,36 @@ Number of gridpoints per band
             }
             ngpp[npartsb[iband] - 1] += remainder;
         }
+        count.insert( count.end(), ngpp.begin(), ngpp.end() );
+    }
+}
+
+void CheckerboardPartitioner::partition( const Checkerboard& cb, int nb_nodes, NodeInt nodes[], int part[] ) const {
+    std::vector<size_t> ngpb, npartsb, count;
+    sizes( cb, nb_nodes, ngpb, npartsb, count );
+
+    /*
+Sort nodes from south to north (increasing y), and west to east (increasing x).
+Now we can easily split
+the points in bands. Note this may not be necessary, as it could be
+already by construction in this order, but then sorting is really fast
+*/
+    std::sort( nodes, nodes + nb_nodes, compare_Y_X );
+
+    // for each band, select gridpoints belonging to that band, and sort them
+    // according to X first
+    size_t offset = 0;
+    int jpart     = 0;
+    for ( size_t iband = 0; iband < ngpb.size(); iband++ ) {
+        // sort according to X first
+        std::sort( nodes + offset, nodes + offset + ngpb[iband], compare_X_Y );
 
         // set partition number for each part
         for ( size_t ipart = 0; ipart < npartsb[iband]; ipart++ ) {
-            for ( size_t jj = offset; jj < offset + ngpp[ipart]; jj++ ) {
+            for ( size_t jj = offset; jj < offset + count[jpart]; jj++ ) {
                 part[nodes[jj].n] = jpart;
             }
-            offset += ngpp[ipart];
+            offset += count[jpart];
             ++jpart;
         }
     }
@@ -247,6 +259,82 @@ void CheckerboardPartitioner::partition( const Grid& grid, int part[] ) const {
     }
 }
 
+Distribution CheckerboardPartitioner::partition( const Grid& grid ) const {
+    std::vector<gidx_t> begin;
+    std::vector<int> part;
+    if ( nb_partitions() == 1 ) {
+        begin = {0, grid.size()};
+        part  = {0};
+    }
+    else {
+        ATLAS_TRACE( "CheckerboardPartitioner::partition" );
+        auto cb = checkerboard( grid );
+
+        std::vector<size_t> ngpb, npartsb, count;
+        sizes( cb, grid.size(), ngpb, npartsb, count );
+
+        // Bands are consecutive ranges of global indices (sorted by row, then column). Within a band, points are
+        // sorted by column, then row, and consecutive partitions take count[p] points each. The rank of a point in
+        // this order grows along a row, so the partitions of each row are found with a binary search per partition.
+        const gidx_t nx = cb.nx;
+        std::vector<gidx_t> rank_begin( nx + 1 );  // rank within the band of the first point of every column
+        size_t p_begin    = 0;
+        gidx_t band_begin = 0;
+        for ( size_t iband = 0; iband < ngpb.size(); ++iband ) {
+            const gidx_t band_end = band_begin + static_cast<gidx_t>( ngpb[iband] );
+            const gidx_t row0     = band_begin / nx;  // first row, starting at column col0
+            const gidx_t col0     = band_begin % nx;
+            const gidx_t row1     = band_end / nx;  // last row, if not empty, ending before column col1
+            const gidx_t col1     = band_end % nx;
+
+            // Rows of the band that contain column ix are [first_row(ix), first_row(ix) + rows_in_column(ix))
+            auto first_row      = [&]( gidx_t ix ) { return row0 + ( ix < col0 ? 1 : 0 ); };
+            auto rows_in_column = [&]( gidx_t ix ) { return row1 + ( ix < col1 ? 1 : 0 ) - first_row( ix ); };
+            for ( gidx_t ix = 0; ix < nx; ++ix ) {
+                rank_begin[ix + 1] = rank_begin[ix] + rows_in_column( ix );
+            }
+            auto rank = [&]( gidx_t ix, gidx_t iy ) { return rank_begin[ix] + iy - first_row( ix ); };
+
+            // Rank of the first point of every partition of the band, followed by the number of points of the band
+            std::vector<gidx_t> part_rank( 1, 0 );
+            for ( size_t ipart = 0; ipart < npartsb[iband]; ++ipart ) {
+                part_rank.emplace_back( part_rank.back() + static_cast<gidx_t>( count[p_begin + ipart] ) );
+            }
+
+            for ( gidx_t iy = row0; iy * nx < band_end; ++iy ) {
+                gidx_t ix_begin = ( iy == row0 ) ? col0 : 0;
+                gidx_t ix_end   = ( iy == row1 ) ? col1 : nx;
+                for ( size_t ipart = 0; ipart < npartsb[iband] && ix_begin < ix_end; ++ipart ) {
+                    gidx_t lo = ix_begin;
+                    gidx_t hi = ix_end;
+                    while ( lo < hi ) {  // first column of the row with rank beyond this partition
+                        gidx_t mid = lo + ( hi - lo ) / 2;
+                        if ( rank( mid, iy ) < part_rank[ipart + 1] ) {
+                            lo = mid + 1;
+                        }
+                        else {
+                            hi = mid;
+                        }
+                    }
+                    if ( lo > ix_begin ) {
+                        const int p = static_cast<int>( p_begin + ipart );
+                        if ( part.empty() || part.back() != p ) {
+                            begin.emplace_back( iy * nx + ix_begin );
+                            part.emplace_back( p );
+                        }
+                        ix_begin = lo;
+                    }
+                }
+            }
+            p_begin += npartsb[iband];
+            band_begin = band_end;
+        }
+        ATLAS_ASSERT( band_begin == grid.size() );
+        begin.emplace_back( grid.size() );
+    }
+    return new distribution::DistributionIntervals( nb_partitions(), std::move( begin ), std::move( part ), type() );
+}
+
 }  // namespace partitioner
 }  // namespace detail
 }  // namespace grid
@@ -52,9 +52,16 @@ private:
     // algorithm is used internally
     void partition( const Checkerboard& cb, int nb_nodes, NodeInt nodes[], int part[] ) const;
 
+    // Number of grid points of every band (ngpb), and of every partition in partition order (count)
+    void sizes( const Checkerboard& cb, size_t nb_nodes, std::vector<size_t>& ngpb, std::vector<size_t>& npartsb,
+                std::vector<size_t>& count ) const;
+
     using Partitioner::partition;
     virtual void partition( const Grid&, int part[] ) const;
 
+    /// @brief Distribution as intervals, computed from the band and partition sizes without sorting any nodes
+    virtual Distribution partition( const Grid& ) const;
+
     void check() const;
 
 private:
@@ -15,10 +15,14 @@
 #include <ctime>
 #include <functional>
 #include <iostream>
+#include <limits>
+#include <utility>
 #include <vector>
 
+#include "atlas/grid/Distribution.h"
 #include "atlas/grid/Iterator.h"
 #include "atlas/grid/StructuredGrid.h"
+#include "atlas/grid/detail/distribution/DistributionIntervals.h"
 #include "atlas/parallel/mpi/Buffer.h"
 #include "atlas/parallel/mpi/mpi.h"
 #include "atlas/parallel/omp/sort.h"
@@ -917,6 +921,163 @@ void EqualRegionsPartitioner::partition( const Grid& grid, int part[] ) const {
     }      // else
 }
 
+Distribution EqualRegionsPartitioner::partition( const Grid& grid ) const {
+    StructuredGrid structured_grid( grid );
+    if ( not structured_grid ) {
+        return Partitioner::partition( grid );
+    }
+
+    std::vector<gidx_t> begin;
+    std::vector<int> part;
+    if ( N_ == 1 ) {
+        begin = {0, grid.size()};
+        part  = {0};
+    }
+    else {
+        ATLAS_TRACE( "EqualRegionsPartitioner::partition" );
+        ATLAS_ASSERT( grid.projection().units() == "degrees" );
+
+        // partition( grid, part[] ) takes the points of a structured grid in order of global index, and splits them
+        // in bands of consecutive global indices. Within a band the points are sorted from west to east, and north to
+        // south, and consecutive partitions take count[p] points each. Each partition of a band therefore starts
+        // at the point of rank sum(count) in this order, which is found by bisection on the longitude.
+        // On every latitude, the rank grows with the longitude, so that the first point of each partition on
+        // the latitude is found with a binary search. Every task computes the same intervals independently.
+        const StructuredGrid& sg = structured_grid;
+
+        // Points of a band on one latitude
+        struct Segment {
+            idx_t j;
+            idx_t i_begin;
+            idx_t i_end;
+            int y;
+            gidx_t lat_begin;  // global index of the first point of the latitude
+        };
+        auto x = [&]( const Segment& s, idx_t i ) -> long { return microdeg( sg.x( i, s.j ) ); };
+
+        // Number of points of a segment before the point (X,Y) in the sorting order of a band
+        auto nb_before = [&]( const Segment& s, long X, int Y ) -> idx_t {
+            idx_t lo = s.i_begin;
+            idx_t hi = s.i_end;
+            while ( lo < hi ) {
+                idx_t mid     = lo + ( hi - lo ) / 2;
+                const long xm = x( s, mid );
+                if ( xm < X || ( xm == X && s.y > Y ) ) {
+                    lo = mid + 1;
+                }
+                else {
+                    hi = mid;
+                }
+            }
+            return lo - s.i_begin;
+        };
+        // Number of points of the segments with a longitude smaller than X
+        auto nb_west_of = [&]( const std::vector<Segment>& segments, long X ) -> gidx_t {
+            gidx_t n = 0;
+            for ( const auto& s : segments ) {
+                n += nb_before( s, X, std::numeric_limits<int>::max() );
+            }
+            return n;
+        };
+
+        const gidx_t nb_nodes   = grid.size();
+        const gidx_t chunk_size = nb_nodes / N_;
+        gidx_t remainder        = nb_nodes - chunk_size * N_;
+
+        std::vector<Segment> segments;
+        std::vector<int> y_at_X;
+        std::vector<std::pair<long, int>> part_first;  // first point (x,y) of every partition of a band
+        std::vector<gidx_t> part_rank;
+        gidx_t band_begin = 0;
+        gidx_t lat_begin  = 0;
+        idx_t j           = 0;
+        int p_begin       = 0;
+        for ( int b = 0; b < nb_bands(); ++b ) {
+            part_rank.assign( 1, 0 );
+            for ( int r = 0; r < nb_regions( b ); ++r ) {
+                part_rank.emplace_back( part_rank.back() + chunk_size + ( remainder-- > 0 ? 1 : 0 ) );
+            }
+            const gidx_t band_end = band_begin + part_rank.back();
+
+            segments.clear();
+            for ( ; j < sg.ny() && lat_begin < band_end; ) {
+                const gidx_t lat_end = lat_begin + sg.nx( j );
+                const idx_t i_begin  = static_cast<idx_t>( std::max( band_begin, lat_begin ) - lat_begin );
+                const idx_t i_end    = static_cast<idx_t>( std::min( band_end, lat_end ) - lat_begin );
+                if ( i_begin < i_end ) {
+                    segments.emplace_back( Segment{j, i_begin, i_end, microdeg( sg.y( j ) ), lat_begin} );
+                }
+                if ( lat_end > band_end ) {
+                    break;  // latitude continues in the next band
+                }
+                lat_begin = lat_end;
+                ++j;
+            }
+
+            long x_min = std::numeric_limits<long>::max();
+            long x_max = std::numeric_limits<long>::min();
+            for ( const auto& s : segments ) {
+                x_min = std::min( x_min, x( s, s.i_begin ) );
+                x_max = std::max( x_max, x( s, s.i_end - 1 ) );
+            }
+
+            // First point of partitions of this band, except the first, in the sorting order of the band
+            part_first.clear();
+            for ( int r = 1; r < nb_regions( b ); ++r ) {
+                const gidx_t rank = part_rank[r];
+                if ( rank >= part_rank.back() ) {
+                    part_first.emplace_back( std::numeric_limits<long>::max(), std::numeric_limits<int>::min() );
+                    continue;
+                }
+                // Smallest longitude X with more than 'rank' points west of or at X
+                long lo = x_min;
+                long hi = x_max;
+                while ( lo < hi ) {
+                    long mid = lo + ( hi - lo ) / 2;
+                    if ( nb_west_of( segments, mid + 1 ) > rank ) {
+                        hi = mid;
+                    }
+                    else {
+                        lo = mid + 1;
+                    }
+                }
+                const long X = lo;
+                // Points at longitude X are sorted from north to south
+                y_at_X.clear();
+                for ( const auto& s : segments ) {
+                    const idx_t n_at_X = nb_before( s, X + 1, std::numeric_limits<int>::max() ) -
+                                         nb_before( s, X, std::numeric_limits<int>::max() );
+                    y_at_X.insert( y_at_X.end(), n_at_X, s.y );
+                }
+                std::sort( y_at_X.begin(), y_at_X.end(), std::greater<int>() );
+                part_first.emplace_back( X, y_at_X[rank - nb_west_of( segments, X )] );
+            }
+
+            for ( const auto& s : segments ) {
+                idx_t i = s.i_begin;
+                for ( int r = 0; r < nb_regions( b ) && i < s.i_end; ++r ) {
+                    const idx_t i_end =
+                        r + 1 < nb_regions( b ) ? s.i_begin + nb_before( s, part_first[r].first, part_first[r].second )
+                                                : s.i_end;
+                    if ( i_end > i ) {
+                        const int p = p_begin + r;
+                        if ( part.empty() || part.back() != p ) {
+                            begin.emplace_back( s.lat_begin + i );
+                            part.emplace_back( p );
+                        }
+                        i = i_end;
+                    }
+                }
+            }
+            p_begin += nb_regions( b );
+            band_begin = band_end;
+        }
+        ATLAS_ASSERT( band_begin == nb_nodes );
+        begin.emplace_back( nb_nodes );
+    }
+    return new distribution::DistributionIntervals( N_, std::move( begin ), std::move( part ), type() );
+}
+
 }  // namespace partitioner
 }  // namespace detail
 }  // namespace grid
@@ -89,6 +89,9 @@ public:
     using Partitioner::partition;
     virtual void partition( const Grid&, int part[] ) const;
 
+    /// @brief Distribution of structured grids as intervals, computed from the regions without sorting any nodes
+    virtual Distribution partition( const Grid& ) const;
+
     virtual std::string type() const { return "equal_regions"; }
 
 public:
@@ -10,6 +10,7 @@
 
 #include "atlas/grid/detail/partitioner/MatchingFunctionSpacePartitionerLonLatPolygon.h"
 
+#include <algorithm>
 #include <vector>
 
 #include "eckit/config/Resource.h"
@@ -17,6 +18,8 @@
 
 #include "atlas/grid/Grid.h"
 #include "atlas/grid/Iterator.h"
+#include "atlas/grid/StructuredGrid.h"
+#include "atlas/grid/detail/partitioner/MatchingPartitionerIntervals.h"
 #include "atlas/parallel/mpi/mpi.h"
 #include "atlas/runtime/Exception.h"
 #include "atlas/runtime/Log.h"
@@ -47,13 +50,23 @@ void MatchingFunctionSpacePartitionerLonLatPolygon::partition( const Grid& grid,
     else {
         const auto& p = partitioned_.polygon();
 
-        int rank = mpi::rank();
         util::PolygonXY poly{p};
-        {
+        GlobalIndexIntervals intervals;
+        StructuredGrid structured( grid );
+        if ( structured ) {
+            // Only points within the range where the polygon crosses each row are tested
+            auto candidates = [&]( idx_t j, double& xmin, double& xmax ) {
+                return poly.xrange( structured.y( j ), xmin, xmax );
+            };
+            auto contains = [&]( idx_t i, idx_t j ) { return poly.contains( structured.xy( i, j ) ); };
+            intervals     = find_intervals( structured, candidates, contains );
+        }
+        else {
             ATLAS_TRACE( "point-in-polygon check for entire grid (" + std::to_string( grid.size() ) + " points)" );
             size_t num_threads = atlas_omp_get_max_threads();
-            size_t chunk_size  = grid.size() / ( 1000 * num_threads );
+            size_t chunk_size  = std::max( size_t( 1 ), size_t( grid.size() ) / ( 1000 * num_threads ) );
             size_t chunks      = num_threads == 1 ? 1 : std::max( size_t( 1 ), size_t( grid.size() ) / chunk_size );
+            std::vector<GlobalIndexIntervals> chunk_intervals( chunks );
             atlas_omp_pragma(omp parallel for schedule(dynamic,1))
             for( size_t chunk=0; chunk < chunks; ++chunk) {
                 const size_t begin = chunk * size_t( grid.size() ) / chunks;
@@ -61,16 +74,24 @@ void MatchingFunctionSpacePartitionerLonLatPolygon::partition( const Grid& grid,
                 auto it            = grid.xy().begin() + chunk * grid.size() / chunks;
                 for ( size_t n = begin; n < end; ++n ) {
                     if ( poly.contains( *it ) ) {
-                        part[n] = rank;
+                        append( chunk_intervals[chunk], n );
+                    }
+                    ++it;
+                }
+            }
+            for ( const auto& chunk : chunk_intervals ) {
+                for ( size_t k = 0; k < chunk.size(); k += 2 ) {
+                    if ( not intervals.empty() && intervals.back() == chunk[k] ) {
+                        intervals.back() = chunk[k + 1];
                     }
                     else {
-                        part[n] = -1;
+                        intervals.push_back( chunk[k] );
+                        intervals.push_back( chunk[k + 1] );
                     }
-                    ++it;
                 }
             }
         }
-        ATLAS_TRACE_MPI( ALLREDUCE ) { mpi::comm().allReduceInPlace( part, grid.size(), eckit::mpi::max() ); }
+        gather_intervals( intervals, grid.size(), part );
     }
 }
 
@@ -10,6 +10,8 @@
 
 #include "atlas/grid/detail/partitioner/MatchingMeshPartitionerLonLatPolygon.h"
 
+#include <algorithm>
+#include <limits>
 #include <vector>
 
 #include "eckit/config/Resource.h"
@@ -17,6 +19,8 @@
 
 #include "atlas/grid/Grid.h"
 #include "atlas/grid/Iterator.h"
+#include "atlas/grid/StructuredGrid.h"
+#include "atlas/grid/detail/partitioner/MatchingPartitionerIntervals.h"
 #include "atlas/mesh/Nodes.h"
 #include "atlas/parallel/mpi/mpi.h"
 #include "atlas/runtime/Exception.h"
@@ -52,22 +56,44 @@ void MatchingMeshPartitionerLonLatPolygon::partition( const Grid& grid, int part
     const util::PolygonXY poly{prePartitionedMesh_.polygon( 0 )};
     Projection projection = prePartitionedMesh_.projection();
 
-    {
+    auto at_the_pole = [&]( double lat ) {
+        return ( includesNorthPole && lat >= poly.coordinatesMax()[LAT] ) ||
+               ( includesSouthPole && lat < poly.coordinatesMin()[LAT] );
+    };
+
+    GlobalIndexIntervals intervals;
+    StructuredGrid structured( grid );
+    if ( structured && not projection && not grid.projection() ) {
+        // Only points within the range where the polygon crosses each latitude are tested
+        auto candidates = [&]( idx_t j, double& xmin, double& xmax ) {
+            if ( at_the_pole( structured.y( j ) ) ) {
+                xmin = std::numeric_limits<double>::lowest();
+                xmax = std::numeric_limits<double>::max();
+                return true;
+            }
+            return poly.xrange( structured.y( j ), xmin, xmax );
+        };
+        auto contains = [&]( idx_t i, idx_t j ) {
+            const PointXY P = structured.xy( i, j );
+            return at_the_pole( P[LAT] ) || poly.contains( P );
+        };
+        intervals = find_intervals( structured, candidates, contains );
+    }
+    else {
         eckit::ProgressTimer timer( "Partitioning", grid.size(), "point", double( 10 ), atlas::Log::trace() );
-        size_t i = 0;
-
+        gidx_t n = 0;
         for ( PointLonLat P : grid.lonlat() ) {
             ++timer;
             projection.lonlat2xy( P );
-            const bool atThePole = ( includesNorthPole && P[LAT] >= poly.coordinatesMax()[LAT] ) ||
-                                   ( includesSouthPole && P[LAT] < poly.coordinatesMin()[LAT] );
-
-            partitioning[i++] = atThePole || poly.contains( P ) ? mpi_rank : -1;
+            if ( at_the_pole( P[LAT] ) || poly.contains( P ) ) {
+                append( intervals, n );
+            }
+            ++n;
         }
     }
 
     // Synchronize partitioning, do a sanity check
-    comm.allReduceInPlace( partitioning, grid.size(), eckit::mpi::Operation::MAX );
+    gather_intervals( intervals, grid.size(), partitioning );
     const int min = *std::min_element( partitioning, partitioning + grid.size() );
     if ( min < 0 ) {
         throw_Exception(
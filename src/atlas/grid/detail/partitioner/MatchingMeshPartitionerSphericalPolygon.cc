@@ -10,12 +10,16 @@
 
 #include "atlas/grid/detail/partitioner/MatchingMeshPartitionerSphericalPolygon.h"
 
+#include <algorithm>
+#include <limits>
 #include <vector>
 
 #include "eckit/log/ProgressTimer.h"
 
 #include "atlas/grid/Grid.h"
 #include "atlas/grid/Iterator.h"
+#include "atlas/grid/StructuredGrid.h"
+#include "atlas/grid/detail/partitioner/MatchingPartitionerIntervals.h"
 #include "atlas/mesh/Nodes.h"
 #include "atlas/parallel/mpi/mpi.h"
 #include "atlas/parallel/omp/fill.h"
@@ -63,18 +67,41 @@ void MatchingMeshPartitionerSphericalPolygon::partition( const Grid& grid, int p
         return ( includesNorthPole && P[LAT] >= maxlat ) || ( includesSouthPole && P[LAT] < minlat );
     };
 
-    {
+    GlobalIndexIntervals intervals;
+    StructuredGrid structured( grid );
+    if ( structured && not grid.projection() ) {
+        // Only points within the range of longitudes of the polygon are tested
+        auto candidates = [&]( idx_t j, double& xmin, double& xmax ) {
+            if ( at_the_pole( PointLonLat{0., structured.y( j )} ) ) {
+                xmin = std::numeric_limits<double>::lowest();
+                xmax = std::numeric_limits<double>::max();
+            }
+            else {
+                xmin = poly.coordinatesMin()[LON];
+                xmax = poly.coordinatesMax()[LON];
+            }
+            return true;
+        };
+        auto contains = [&]( idx_t i, idx_t j ) {
+            const PointLonLat P = structured.lonlat( i, j );
+            return at_the_pole( P ) || poly.contains( P );
+        };
+        intervals = find_intervals( structured, candidates, contains );
+    }
+    else {
         eckit::ProgressTimer timer( "Partitioning", grid.size(), "point", double( 10 ), atlas::Log::trace() );
-        size_t i = 0;
-
+        gidx_t n = 0;
         for ( const PointLonLat& P : grid.lonlat() ) {
             ++timer;
-            partitioning[i++] = at_the_pole( P ) || poly.contains( P ) ? mpi_rank : -1;
+            if ( at_the_pole( P ) || poly.contains( P ) ) {
+                append( intervals, n );
+            }
+            ++n;
         }
     }
 
     // Synchronize partitioning, do a sanity check
-    comm.allReduceInPlace( partitioning, grid.size(), eckit::mpi::Operation::MAX );
+    gather_intervals( intervals, grid.size(), partitioning );
     const int min = *std::min_element( partitioning, partitioning + grid.size() );
     if ( min < 0 ) {
         throw_Exception(
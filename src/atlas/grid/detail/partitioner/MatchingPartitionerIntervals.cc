@@ -0,0 +1,100 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include "atlas/grid/detail/partitioner/MatchingPartitionerIntervals.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "eckit/mpi/Buffer.h"
+
+#include "atlas/grid/StructuredGrid.h"
+#include "atlas/parallel/mpi/Statistics.h"
+#include "atlas/parallel/mpi/mpi.h"
+#include "atlas/parallel/omp/fill.h"
+#include "atlas/parallel/omp/omp.h"
+#include "atlas/runtime/Trace.h"
+
+namespace atlas {
+namespace grid {
+namespace detail {
+namespace partitioner {
+
+GlobalIndexIntervals find_intervals( const StructuredGrid& grid,
+                                     const std::function<bool( idx_t j, double& xmin, double& xmax )>& candidates,
+                                     const std::function<bool( idx_t i, idx_t j )>& contains ) {
+    ATLAS_TRACE( "find_intervals" );
+    const idx_t ny = grid.ny();
+    std::vector<GlobalIndexIntervals> row_intervals( ny );
+    atlas_omp_parallel_for( idx_t j = 0; j < ny; ++j ) {
+        double xmin;
+        double xmax;
+        if ( not candidates( j, xmin, xmax ) ) {
+            continue;
+        }
+        const double tolerance = 1.e-10 * std::max( 1., std::max( std::abs( xmin ), std::abs( xmax ) ) );
+
+        // x increases with i
+        idx_t begin = 0;
+        idx_t end   = grid.nx( j );
+        for ( idx_t count = end; count > 0; ) {
+            const idx_t step = count / 2;
+            if ( grid.x( begin + step, j ) < xmin - tolerance ) {
+                begin += step + 1;
+                count -= step + 1;
+            }
+            else {
+                count = step;
+            }
+        }
+        for ( idx_t i = begin; i < end && grid.x( i, j ) <= xmax + tolerance; ++i ) {
+            if ( contains( i, j ) ) {
+                append( row_intervals[j], grid.index( i, j ) );
+            }
+        }
+    }
+
+    GlobalIndexIntervals intervals;
+    for ( const auto& row : row_intervals ) {
+        for ( size_t k = 0; k < row.size(); k += 2 ) {
+            // Intervals of consecutive rows may join
+            if ( not intervals.empty() && intervals.back() == row[k] ) {
+                intervals.back() = row[k + 1];
+            }
+            else {
+                intervals.push_back( row[k] );
+                intervals.push_back( row[k + 1] );
+            }
+        }
+    }
+    return intervals;
+}
+
+void gather_intervals( const GlobalIndexIntervals& intervals, gidx_t size, int partitioning[] ) {
+    ATLAS_TRACE( "gather_intervals" );
+    const auto& comm = mpi::comm();
+
+    eckit::mpi::Buffer<gidx_t> recv( comm.size() );
+    ATLAS_TRACE_MPI( ALLGATHER ) { comm.allGatherv( intervals.begin(), intervals.end(), recv ); }
+
+    omp::fill( partitioning, partitioning + size, -1 );
+    for ( size_t p = 0; p < comm.size(); ++p ) {
+        const gidx_t* task_intervals = recv.buffer.data() + recv.displs[p];
+        const size_t nb_intervals    = static_cast<size_t>( recv.counts[p] ) / 2;
+        atlas_omp_parallel_for( size_t k = 0; k < nb_intervals; ++k ) {
+            std::fill( partitioning + task_intervals[2 * k], partitioning + task_intervals[2 * k + 1], int( p ) );
+        }
+    }
+}
+
+}  // namespace partitioner
+}  // namespace detail
+}  // namespace grid
+}  // namespace atlas
@@ -0,0 +1,61 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#pragma once
+
+#include <functional>
+#include <vector>
+
+#include "atlas/library/config.h"
+
+namespace atlas {
+class StructuredGrid;
+}  // namespace atlas
+
+namespace atlas {
+namespace grid {
+namespace detail {
+namespace partitioner {
+
+/// @brief Global indices of grid points, stored as begin and end of intervals [begin,end) of consecutive indices
+using GlobalIndexIntervals = std::vector<gidx_t>;
+
+/// @brief Append global index to intervals, where indices are appended in increasing order
+inline void append( GlobalIndexIntervals& intervals, gidx_t n ) {
+    if ( not intervals.empty() && intervals.back() == n ) {
+        ++intervals.back();
+    }
+    else {
+        intervals.push_back( n );
+        intervals.push_back( n + 1 );
+    }
+}
+
+/// @brief Find the points of a structured grid for which contains(i,j) is true, testing only candidate points
+///
+/// For every row j, candidates(j,xmin,xmax) returns false if no point of the row needs to be tested, or otherwise
+/// sets the range [xmin,xmax] of x coordinates of the points to be tested. The candidates of a row are located with
+/// a binary search, with a small tolerance on the range. Rows are processed in parallel.
+GlobalIndexIntervals find_intervals( const StructuredGrid&,
+                                     const std::function<bool( idx_t j, double& xmin, double& xmax )>& candidates,
+                                     const std::function<bool( idx_t i, idx_t j )>& contains );
+
+/// @brief Fill the partition of every grid point from the intervals found by all tasks
+///
+/// Points that are not found by any task get partition -1. Points found by several tasks get the highest task.
+/// Only the intervals are communicated, which is far less than the number of grid points when every task finds
+/// contiguous ranges of points.
+/// @note Collective operation
+void gather_intervals( const GlobalIndexIntervals&, gidx_t size, int partitioning[] );
+
+}  // namespace partitioner
+}  // namespace detail
+}  // namespace grid
+}  // namespace atlas
@@ -12,13 +12,16 @@
 
 #include <map>
 #include <string>
+#include <utility>
 
 #include "eckit/thread/AutoLock.h"
 #include "eckit/thread/Mutex.h"
 
 #include "atlas/grid/Distribution.h"
 #include "atlas/grid/Partitioner.h"
+#include "atlas/grid/StructuredGrid.h"
 #include "atlas/grid/detail/distribution/DistributionArray.h"
+#include "atlas/grid/detail/distribution/DistributionIntervals.h"
 #include "atlas/grid/detail/partitioner/BandsPartitioner.h"
 #include "atlas/grid/detail/partitioner/CheckerboardPartitioner.h"
 #include "atlas/grid/detail/partitioner/EqualBandsPartitioner.h"
@@ -68,6 +71,18 @@ idx_t Partitioner::nb_partitions() const {
 }
 
 Distribution Partitioner::partition( const Grid& grid ) const {
+    if ( StructuredGrid( grid ) ) {
+        // Partitions of structured grids mostly consist of contiguous ranges of points on each latitude,
+        // which are stored much more compactly as intervals than as one partition per grid point.
+        // Fragmented partitions, e.g. from matching partitioners, are kept as an array, as their intervals
+        // would take more memory and a binary search per lookup.
+        distribution::DistributionArray::partition_t part( grid.size() );
+        partition( grid, part.data() );
+        if ( distribution::DistributionIntervals::count_intervals( part.data(), grid.size() ) <= grid.size() / 8 ) {
+            return new distribution::DistributionIntervals{atlas::grid::Partitioner( this ), part.data(), grid.size()};
+        }
+        return new distribution::DistributionArray{atlas::grid::Partitioner( this ), std::move( part )};
+    }
     return new distribution::DistributionArray{grid, atlas::grid::Partitioner( this )};
 }
 
@@ -12,15 +12,21 @@
 /// @author Willem Deconinck
 /// @date   Jan 2014
 
+#include <algorithm>
+#include <cmath>
 #include <limits>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <sstream>
+#include <vector>
 
 #include "eckit/log/Bytes.h"
 
-#include "atlas/array.h"
 #include "atlas/grid/detail/spacing/gaussian/Latitudes.h"
 #include "atlas/grid/detail/spacing/gaussian/N.h"
 #include "atlas/library/config.h"
+#include "atlas/parallel/omp/omp.h"
 #include "atlas/runtime/Exception.h"
 #include "atlas/runtime/Log.h"
 #include "atlas/runtime/Trace.h"
@@ -30,10 +36,6 @@
 //using eckit::ConcreteBuilderT0;
 //using eckit::Factory;
 
-using atlas::array::Array;
-using atlas::array::ArrayView;
-using atlas::array::make_view;
-
 namespace atlas {
 namespace grid {
 namespace spacing {
@@ -45,6 +47,32 @@ void compute_gaussian_quadrature_npole_equator( const size_t N, double lat[], do
 
 //-----------------------------------------------------------------------------
 
+namespace {
+
+struct Quadrature {
+    Quadrature( size_t N ) : lats( N ), weights( N ) {
+        compute_gaussian_quadrature_npole_equator( N, lats.data(), weights.data() );
+    }
+    std::vector<double> lats;
+    std::vector<double> weights;
+};
+
+/// Computed quadratures are kept for the lifetime of the program, as the same N is typically requested many times
+std::shared_ptr<const Quadrature> cached_quadrature_npole_equator( size_t N ) {
+    static std::mutex mutex;
+    static std::map<size_t, std::shared_ptr<const Quadrature>> cache;
+    std::lock_guard<std::mutex> lock( mutex );
+    auto& quadrature = cache[N];
+    if ( not quadrature ) {
+        quadrature = std::make_shared<const Quadrature>( N );
+    }
+    return quadrature;
+}
+
+}  // namespace
+
+//-----------------------------------------------------------------------------
+
 void gaussian_latitudes_npole_equator( const size_t N, double lats[] ) {
     std::stringstream Nstream;
     Nstream << N;
@@ -58,8 +86,8 @@ void gaussian_latitudes_npole_equator( const size_t N, double lats[] ) {
     //        gl->assign( lats, N );
     //    }
     else {
-        std::vector<double> weights( N );
-        compute_gaussian_quadrature_npole_equator( N, lats, weights.data() );
+        auto quadrature = cached_quadrature_npole_equator( N );
+        std::copy( quadrature->lats.begin(), quadrature->lats.end(), lats );
     }
 }
 
@@ -76,7 +104,9 @@ void gaussian_latitudes_npole_spole( const size_t N, double lats[] ) {
 //-----------------------------------------------------------------------------
 
 void gaussian_quadrature_npole_equator( const size_t N, double lats[], double weights[] ) {
-    compute_gaussian_quadrature_npole_equator( N, lats, weights );
+    auto quadrature = cached_quadrature_npole_equator( N );
+    std::copy( quadrature->lats.begin(), quadrature->lats.end(), lats );
+    std::copy( quadrature->weights.begin(), quadrature->weights.end(), weights );
 }
 
 //-----------------------------------------------------------------------------
@@ -95,6 +125,9 @@ void gaussian_quadrature_npole_spole( const size_t N, double lats[], double weig
 
 namespace {  // Anonymous namespace
 
+// Maximum number of Newton iterations to converge a gaussian latitude
+constexpr int legpol_quadrature_itemax = 20;
+
 //-----------------------------------------------------------------------------
 
 void legpol_newton_iteration( int kn, const double pfn[], double px, double& pxn, double& pxmod ) {
@@ -173,7 +206,7 @@ void legpol_weight( const int kn, const double pfn[], const double px, double& p
 
 //-----------------------------------------------------------------------------
 
-void legpol_quadrature( const int kn, const double pfn[], double& pl, double& pw, int& kiter, double& pmod ) {
+bool legpol_quadrature( const int kn, const double pfn[], double& pl, double& pw, int& kiter, double& pmod ) {
     //**** *GAWL * - Routine to perform the Newton loop
 
     //     Purpose.
@@ -192,6 +225,7 @@ void legpol_quadrature( const int kn, const double pfn[], double& pl, double& pw
     // KN     Truncation                                (in)
     // KITER  Number of iterations                      (out)
     // PMOD   Last modification                         (inout)
+    // Returns false if the Newton loop did not converge
 
     int iflag, itemax;
 
@@ -202,7 +236,7 @@ void legpol_quadrature( const int kn, const double pfn[], double& pl, double& pw
     //*       1. Initialization.
     //           ---------------
 
-    itemax = 20;
+    itemax = legpol_quadrature_itemax;
     zx     = pl;
     iflag  = 0;
     pw     = 0.;
@@ -225,14 +259,12 @@ void legpol_quadrature( const int kn, const double pfn[], double& pl, double& pw
         }
     }
     if ( iflag != 1 ) {
-        std::stringstream s;
-        s << "Could not converge gaussian latitude to accuracy [" << zeps * 1000 << "]\n";
-        s << "after " << itemax << " iterations. Consequently also failed to compute quadrature weight.";
-        throw_Exception( s.str(), Here() );
+        return false;
     }
 
     pl = zxn;
     pw = zw;
+    return true;
 }
 
 //-----------------------------------------------------------------------------
@@ -243,59 +275,59 @@ void legpol_quadrature( const int kn, const double pfn[], double& pl, double& pw
 
 void compute_gaussian_quadrature_npole_equator( const size_t N, double lats[], double weights[] ) {
     Log::debug() << "Atlas computing Gaussian latitudes for N " << N << " which requires temporary memory of "
-                 << eckit::Bytes( sizeof( double ) * ( 2 * N + 1 ) * ( 2 * N + 1 ) ) << std::endl;
+                 << eckit::Bytes( sizeof( double ) * ( 3 * N + 2 ) ) << std::endl;
     ATLAS_TRACE();
 
-    // Compute first guess for colatitudes in radians
-    double z;
-    for ( size_t i = 0; i < N; ++i ) {
-        z       = ( 4. * ( i + 1. ) - 1. ) * M_PI / ( 4. * 2. * N + 2. );
-        lats[i] = ( z + 1. / ( tan( z ) * ( 8. * ( 2. * N ) * ( 2. * N ) ) ) );
-    }
-
-    int kdgl = 2 * N;
-    array::ArrayT<double> zfn_( kdgl + 1, kdgl + 1 );
-    //    WARNING: potentially HUGE allocation ( N=16000 --> 7.6 Gbytes )
-
-    ArrayView<double, 2> zfn = make_view<double, 2>( zfn_ );
-
-    int iodd;
+    const int kdgl = 2 * N;
+    const int iodd = kdgl % 2;
 
+    // Fourier coefficients of the normalised Legendre polynomial of degree kdgl.
+    // Only this degree is needed, so that the coefficients of lower degrees are not stored.
     // Belousov, Swarztrauber use zfn(0,0)=std::sqrt(2.)
     // IFS normalisation chosen to be 0.5*Integral(Pnm**2) = 1
-    zfn( 0, 0 ) = 2.;
-    for ( int jn = 1; jn <= kdgl; ++jn ) {
-        double zfnn = zfn( 0, 0 );
-        for ( int jgl = 1; jgl <= jn; ++jgl ) {
-            zfnn *= std::sqrt( 1. - 0.25 / ( static_cast<double>( jgl * jgl ) ) );
-        }
-        iodd          = jn % 2;
-        zfn( jn, jn ) = zfnn;
-        for ( int jgl = 2; jgl <= jn - iodd; jgl += 2 ) {
-            zfn( jn, jn - jgl ) = zfn( jn, jn - jgl + 2 ) * static_cast<double>( ( jgl - 1 ) * ( 2 * jn - jgl + 2 ) ) /
-                                  static_cast<double>( jgl * ( 2 * jn - jgl + 1 ) );
-        }
+    std::vector<double> zfn( kdgl + 1 );
+    double zfnn = 2.;
+    for ( int jgl = 1; jgl <= kdgl; ++jgl ) {
+        zfnn *= std::sqrt( 1. - 0.25 / ( static_cast<double>( jgl * jgl ) ) );
+    }
+    zfn[kdgl] = zfnn;
+    for ( int jgl = 2; jgl <= kdgl - iodd; jgl += 2 ) {
+        zfn[kdgl - jgl] = zfn[kdgl - jgl + 2] * static_cast<double>( ( jgl - 1 ) * ( 2 * kdgl - jgl + 2 ) ) /
+                          static_cast<double>( jgl * ( 2 * kdgl - jgl + 1 ) );
     }
-
-    iodd   = kdgl % 2;
-    int ik = iodd;
 
     std::vector<double> zzfn( N + 1 );
-    std::vector<double> zmod( kdgl );
-    std::vector<int> iter( kdgl );
-
+    int ik = iodd;
     for ( int jgl = iodd; jgl <= kdgl; jgl += 2 ) {
-        zzfn[ik] = zfn( kdgl, jgl );
+        zzfn[ik] = zfn[jgl];
         ++ik;
     }
 
+    // Every latitude is independently refined, with cost O(N) per latitude
     const double pole = 90.;
-    for ( size_t jgl = 0; jgl < N; ++jgl ) {
+    size_t failed     = N;
+    atlas_omp_parallel_for( size_t jgl = 0; jgl < N; ++jgl ) {
+        // Compute first guess for colatitude in radians
+        const double z = ( 4. * ( jgl + 1. ) - 1. ) * M_PI / ( 4. * 2. * N + 2. );
+        double colat   = ( z + 1. / ( std::tan( z ) * ( 8. * ( 2. * N ) * ( 2. * N ) ) ) );
+
         // refine colat first guess here via Newton's method
-        legpol_quadrature( kdgl, zzfn.data(), lats[jgl], weights[jgl], iter[jgl], zmod[jgl] );
+        int iter;
+        double zmod;
+        if ( not legpol_quadrature( kdgl, zzfn.data(), colat, weights[jgl], iter, zmod ) ) {
+            atlas_omp_critical { failed = std::min( failed, jgl ); }
+        }
 
         // Convert colat to lat, in degrees
-        lats[jgl] = pole - lats[jgl] * util::Constants::radiansToDegrees();
+        lats[jgl] = pole - colat * util::Constants::radiansToDegrees();
+    }
+    if ( failed < N ) {
+        std::stringstream s;
+        s << "Could not converge gaussian latitude " << failed << " to accuracy ["
+          << std::numeric_limits<double>::epsilon() * 1000 << "]\n";
+        s << "after " << legpol_quadrature_itemax << " iterations. ";
+        s << "Consequently also failed to compute quadrature weight.";
+        throw_Exception( s.str(), Here() );
     }
 }
 
@@ -9,10 +9,100 @@
  */
 
 #include "atlas/interpolation/Cache.h"
+
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#include <ostream>
+
+#include "atlas/grid/Grid.h"
 #include "atlas/interpolation/Interpolation.h"
+#include "atlas/parallel/mpi/mpi.h"
+#include "atlas/runtime/Exception.h"
+#include "atlas/runtime/Log.h"
+#include "atlas/runtime/Trace.h"
+
 namespace atlas {
 namespace interpolation {
 
+namespace {
+
+/// Exclusive advisory lock on a lock file, held from construction until going out of scope
+///
+/// The lock is taken with flock(), so that the kernel releases it when the holding process dies, and a task that
+/// crashes can never block the others. The lock file itself is left in place.
+class FileLock {
+public:
+    FileLock( const eckit::PathName& path ) {
+        fd_ = ::open( path.localPath(), O_CREAT | O_RDWR, 0644 );
+        if ( fd_ < 0 ) {
+            throw_Exception( "Could not open lock file " + path.asString() + ": " + std::strerror( errno ), Here() );
+        }
+        while ( ::flock( fd_, LOCK_EX ) != 0 ) {
+            if ( errno != EINTR ) {
+                int err = errno;
+                ::close( fd_ );
+                throw_Exception( "Could not lock file " + path.asString() + ": " + std::strerror( err ), Here() );
+            }
+        }
+    }
+    ~FileLock() {
+        ::flock( fd_, LOCK_UN );
+        ::close( fd_ );
+    }
+    FileLock( const FileLock& ) = delete;
+    FileLock& operator=( const FileLock& ) = delete;
+
+private:
+    int fd_;
+};
+
+util::IndexKDTree mapped_kdtree( const Grid& grid, const eckit::PathName& directory ) {
+    ATLAS_TRACE();
+    using Tree = eckit::KDTreeMapped<util::IndexKDTree::Implementation::KDTreeTraits>;
+
+    const eckit::PathName path = directory / ( "IndexKDTree-" + grid.hash() + ".kdtree" );
+    if ( not path.exists() ) {
+        // Tasks take the lock in turn: the first one builds the tree, and the others wait in the lock and then find
+        // the completed file. The tree is built in a file private to this task, and renamed when complete, so that
+        // tasks mapping it never see an incomplete file. If building fails, the private file is removed and the
+        // lock released, so that the next task builds instead.
+        directory.mkdir();
+        const eckit::PathName lock( path.asString() + ".lock" );
+        Log::debug() << "Locking k-d tree cache file " << path << " (lock file " << lock << ")" << std::endl;
+        FileLock locked( lock );
+        if ( not path.exists() ) {
+            Log::debug() << "Building k-d tree cache file " << path << std::endl;
+            const eckit::PathName tmp( path.asString() + "." + std::to_string( mpi::rank() ) + "." +
+                                       std::to_string( ::getpid() ) );
+            try {
+                util::IndexKDTree tree( std::make_shared<Tree>( tmp, static_cast<size_t>( grid.size() ), 0 ) );
+                tree.reserve( grid.size() );
+                idx_t n{0};
+                for ( auto p : grid.lonlat() ) {
+                    tree.insert( p, n++ );
+                }
+                tree.build();
+            }
+            catch ( ... ) {
+                ::unlink( tmp.localPath() );
+                throw;
+            }
+            eckit::PathName::rename( tmp, path );
+        }
+    }
+    Log::debug() << "Mapping k-d tree cache file " << path << std::endl;
+    util::IndexKDTree tree( std::make_shared<Tree>( path, 0, 0 ) );
+    ATLAS_ASSERT( tree.size() == static_cast<size_t>( grid.size() ) );
+    return tree;
+}
+
+}  // namespace
+
 InterpolationCacheEntry::~InterpolationCacheEntry() = default;
 
 Cache::Cache( std::shared_ptr<InterpolationCacheEntry> cache ) {
@@ -57,6 +147,60 @@ private:
 };
 
 
+/// Allocator of a matrix that maps the arrays of the matrix from a file written with SparseMatrix::save()
+class MatrixMappedFileAllocator : public eckit::linalg::SparseMatrix::Allocator {
+public:
+    using Layout = eckit::linalg::SparseMatrix::Layout;
+    using Shape  = eckit::linalg::SparseMatrix::Shape;
+
+    MatrixMappedFileAllocator( const eckit::PathName& path ) : path_( path ) {}
+
+    ~MatrixMappedFileAllocator() override {
+        if ( address_ ) {
+            ::munmap( address_, size_ );
+        }
+    }
+
+    Layout allocate( Shape& shape ) override {
+        ATLAS_TRACE( "MatrixMappedFileAllocator::allocate" );
+        Log::debug() << "Mapping matrix cache from file " << path_ << std::endl;
+        int fd = ::open( path_.localPath(), O_RDONLY );
+        if ( fd < 0 ) {
+            throw_Exception( "Could not open cache file " + path_.asString() + ": " + std::strerror( errno ), Here() );
+        }
+        struct stat st;
+        if ( ::fstat( fd, &st ) != 0 ) {
+            int err = errno;
+            ::close( fd );
+            throw_Exception( "Could not stat cache file " + path_.asString() + ": " + std::strerror( err ), Here() );
+        }
+        size_         = static_cast<size_t>( st.st_size );
+        void* address = ::mmap( nullptr, size_, PROT_READ, MAP_SHARED, fd, 0 );
+        int err       = errno;
+        // The mapping remains valid after closing the file descriptor
+        ::close( fd );
+        if ( address == MAP_FAILED ) {
+            throw_Exception( "Could not map cache file " + path_.asString() + ": " + std::strerror( err ), Here() );
+        }
+        address_ = address;
+
+        Layout layout;
+        eckit::linalg::SparseMatrix::load( address_, size_, layout, shape );
+        return layout;
+    }
+
+    void deallocate( Layout, Shape ) override {}
+
+    bool inSharedMemory() const override { return true; }
+
+    void print( std::ostream& out ) const override { out << "MatrixMappedFileAllocator[path=" << path_ << "]"; }
+
+private:
+    const eckit::PathName path_;
+    void* address_{nullptr};
+    size_t size_{0};
+};
+
 MatrixCache::MatrixCache( const Cache& c ) :
     Cache( c ), matrix_{dynamic_cast<const MatrixCacheEntry*>( c.get( MatrixCacheEntry::static_type() ) )} {}
 
@@ -69,6 +213,9 @@ MatrixCache::MatrixCache( const Matrix* m ) : MatrixCache( std::make_shared<Matr
 
 MatrixCache::MatrixCache( const Interpolation& interpolation ) : MatrixCache( Cache( interpolation ) ) {}
 
+MatrixCache::MatrixCache( const eckit::PathName& path ) :
+    MatrixCache( Matrix( new MatrixMappedFileAllocator( path ) ) ) {}
+
 MatrixCache::operator bool() const {
     return matrix_ && !matrix().empty();
 }
@@ -106,6 +253,9 @@ IndexKDTreeCache::IndexKDTreeCache( const IndexKDTree& tree ) :
 
 IndexKDTreeCache::IndexKDTreeCache( const Interpolation& interpolation ) : IndexKDTreeCache( Cache( interpolation ) ) {}
 
+IndexKDTreeCache::IndexKDTreeCache( const Grid& grid, const eckit::PathName& directory ) :
+    IndexKDTreeCache( mapped_kdtree( grid, directory ) ) {}
+
 IndexKDTreeCache::operator bool() const {
     return tree_;  //&& !tree().empty();
 }
@@ -26,6 +26,7 @@
 // Forward declarations
 
 namespace atlas {
+class Grid;
 class Interpolation;
 }  // namespace atlas
 
@@ -107,6 +108,13 @@ public:
     MatrixCache( std::shared_ptr<const Matrix> m );
     MatrixCache( const Matrix* m );
     MatrixCache( const Interpolation& );
+
+    /// @brief Cache of a matrix stored in a file with eckit::linalg::SparseMatrix::save()
+    ///
+    /// The file is mapped read-only in memory, so that pages are shared via the operating system page cache between
+    /// all processes that map the same file.
+    MatrixCache( const eckit::PathName& path );
+
     operator bool() const;
     const Matrix& matrix() const;
     size_t footprint() const;
@@ -142,6 +150,15 @@ public:
     IndexKDTreeCache( const Cache& c );
     IndexKDTreeCache( const IndexKDTree& );
     IndexKDTreeCache( const Interpolation& );
+
+    /// @brief Cache of the k-d tree of the grid points, stored in a file in given directory
+    ///
+    /// The file name contains the grid hash. If the file does not exist yet, the tree is built once with the
+    /// grid index as payload, and stored in the file. The tree is then mapped read-only from the file, so that
+    /// pages are shared via the operating system page cache between all processes on a node that use the same
+    /// grid, and later runs do not need to build the tree again.
+    IndexKDTreeCache( const Grid&, const eckit::PathName& directory );
+
     operator bool() const;
     const IndexKDTree& tree() const;
     size_t footprint() const;
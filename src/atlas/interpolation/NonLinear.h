@@ -67,6 +67,15 @@ struct NonLinear : DOXYGEN_HIDE( public util::ObjectHandle<nonlinear::NonLinear>
      * @return if W was modified
      */
     bool execute( Matrix& W, const Field& f ) const;
+
+    /**
+     * @brief Interpolate applying non-linear corrections on the fly, without modifying (or copying) the matrix
+     * @param [in] W interpolation matrix
+     * @param [in] src field with missing values information
+     * @param [out] tgt interpolated field
+     * @return if supported for this field (otherwise tgt is untouched)
+     */
+    bool interpolate( const Matrix& W, const Field& src, Field& tgt ) const;
 };
 
 
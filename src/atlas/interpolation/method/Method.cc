@@ -10,21 +10,33 @@
 
 #include "atlas/interpolation/method/Method.h"
 
+#include <unistd.h>
+#include <sstream>
+#include <string>
+
+#include "eckit/config/Resource.h"
+#include "eckit/filesystem/PathName.h"
+#include "eckit/log/JSON.h"
 #include "eckit/log/Timer.h"
 #include "eckit/thread/AutoLock.h"
 #include "eckit/thread/Mutex.h"
 #include "eckit/thread/Once.h"
+#include "eckit/utils/MD5.h"
 
 #include "atlas/array.h"
 #include "atlas/field/Field.h"
 #include "atlas/field/FieldSet.h"
 #include "atlas/field/MissingValue.h"
 #include "atlas/functionspace/NodeColumns.h"
+#include "atlas/grid/Grid.h"
+#include "atlas/grid/Partitioner.h"
 #include "atlas/linalg/sparse.h"
 #include "atlas/mesh/Nodes.h"
+#include "atlas/parallel/mpi/mpi.h"
 #include "atlas/runtime/Exception.h"
 #include "atlas/runtime/Log.h"
 #include "atlas/runtime/Trace.h"
+#include "atlas/util/Config.h"
 
 using namespace atlas::linalg;
 namespace atlas {
@@ -105,6 +117,28 @@ Method::Method( const Method::Config& config ) {
     matrix_shared_ = std::make_shared<Matrix>();
     matrix_cache_  = interpolation::MatrixCache( matrix_shared_ );
     matrix_        = matrix_shared_.get();
+
+    static std::string matrix_cache_path = eckit::Resource<std::string>( "$ATLAS_INTERPOLATION_MATRIX_CACHE_PATH", "" );
+    matrix_cache_path_                   = matrix_cache_path;
+    config.get( "matrix_cache_path", matrix_cache_path_ );
+    if ( auto configuration = dynamic_cast<const eckit::Configuration*>( &config ) ) {
+        // The location of the matrix cache does not change the matrix, so is left out of the hash
+        util::Config method_config;
+        eckit::Value& method_values = const_cast<eckit::Value&>( method_config.get() );
+        const eckit::ValueMap values = util::Config( *configuration ).get();
+        for ( const auto& value : values ) {
+            if ( std::string( value.first ) != "matrix_cache_path" ) {
+                method_values[value.first] = value.second;
+            }
+        }
+        std::stringstream s;
+        eckit::JSON json( s );
+        json.precision( 17 );
+        json << method_config;
+        eckit::MD5 md5;
+        md5.add( s.str() );
+        config_hash_ = md5.digest();
+    }
 }
 
 void Method::setup( const FunctionSpace& source, const FunctionSpace& target ) {
@@ -114,7 +148,7 @@ void Method::setup( const FunctionSpace& source, const FunctionSpace& target ) {
 
 void Method::setup( const Grid& source, const Grid& target ) {
     ATLAS_TRACE( "atlas::interpolation::method::Method::setup(Grid, Grid)" );
-    this->do_setup( source, target, Cache() );
+    setup_with_matrix_file( source, target, Cache() );
 }
 
 void Method::setup( const FunctionSpace& source, const Field& target ) {
@@ -129,7 +163,57 @@ void Method::setup( const FunctionSpace& source, const FieldSet& target ) {
 
 void Method::setup( const Grid& source, const Grid& target, const Cache& cache ) {
     ATLAS_TRACE( "atlas::interpolation::method::Method::setup(Grid, Grid, Cache)" );
+    setup_with_matrix_file( source, target, cache );
+}
+
+void Method::setup_with_matrix_file( const Grid& source, const Grid& target, const Cache& cache ) {
+    if ( matrix_cache_path_.empty() || config_hash_.empty() || interpolation::MatrixCache( cache ) ) {
+        this->do_setup( source, target, cache );
+        return;
+    }
+
+    // The matrix depends on the grids, the configuration of the method, and the distribution over tasks.
+    // Grids are distributed as by the default partitioner of the mesh generators, which depends on the build
+    std::string distribution_type = "serial";
+    if ( mpi::size() > 1 ) {
+        distribution_type = grid::Partitioner::exists( "trans" ) ? "trans" : "equal_regions";
+    }
+    eckit::MD5 md5;
+    md5.add( source.hash() );
+    md5.add( target.hash() );
+    md5.add( config_hash_ );
+    md5.add( distribution_type );
+    md5.add( static_cast<long>( mpi::size() ) );
+    md5.add( static_cast<long>( mpi::rank() ) );
+    const eckit::PathName directory( matrix_cache_path_ );
+    const eckit::PathName path = directory / ( "Matrix-" + md5.digest() + ".mat" );
+
+    if ( path.exists() ) {
+        Cache cache_with_matrix( cache );
+        cache_with_matrix.add( interpolation::MatrixCache( path ) );
+        this->do_setup( source, target, cache_with_matrix );
+        return;
+    }
+
     this->do_setup( source, target, cache );
+
+    if ( not matrix_->empty() ) {
+        ATLAS_TRACE( "Store matrix cache file" );
+        Log::debug() << "Storing matrix cache file " << path << std::endl;
+        // The matrix is saved to a file private to this task and renamed when complete, so that no other task
+        // maps an incomplete file
+        directory.mkdir();
+        const eckit::PathName tmp( path.asString() + "." + std::to_string( mpi::rank() ) + "." +
+                                   std::to_string( ::getpid() ) );
+        try {
+            matrix_->save( tmp );
+        }
+        catch ( ... ) {
+            ::unlink( tmp.localPath() );
+            throw;
+        }
+        eckit::PathName::rename( tmp, path );
+    }
 }
 
 void Method::execute( const FieldSet& source, FieldSet& target ) const {
@@ -150,13 +234,97 @@ void Method::do_setup( const FunctionSpace& /*source*/, const FieldSet& /*target
     ATLAS_NOTIMPLEMENTED;
 }
 
+bool Method::batchable( const Field& src, const Field& tgt ) const {
+    if ( use_eckit_linalg_spmv_ || matrix_->empty() || nonLinear_( src ) ) {
+        return false;
+    }
+    if ( src.datatype() != tgt.datatype() || src.rank() != tgt.rank() || src.rank() > 3 ) {
+        return false;
+    }
+    if ( src.datatype().kind() != array::DataType::KIND_REAL64 &&
+         src.datatype().kind() != array::DataType::KIND_REAL32 ) {
+        return false;
+    }
+    return src.contiguous() && tgt.contiguous();
+}
+
+template <typename Value>
+void Method::interpolate_fields_batched( const std::vector<Field>& src, std::vector<Field>& tgt,
+                                         const Matrix& W ) const {
+    // Contiguous fields of any rank are seen as (points, values per point)
+    std::vector<View<const Value, 2>> src_v;
+    std::vector<View<Value, 2>> tgt_v;
+    src_v.reserve( src.size() );
+    tgt_v.reserve( tgt.size() );
+    for ( size_t i = 0; i < src.size(); ++i ) {
+        check_compatibility( src[i], tgt[i], W );
+        src_v.emplace_back( src[i].array().host_data<Value>(),
+                            array::make_shape( src[i].shape( 0 ), src[i].stride( 0 ) ) );
+        tgt_v.emplace_back( tgt[i].array().host_data<Value>(),
+                            array::make_shape( tgt[i].shape( 0 ), tgt[i].stride( 0 ) ) );
+    }
+    sparse_matrix_multiply_batched( W, src_v, tgt_v, sparse::backend::omp() );
+}
+
 void Method::do_execute( const FieldSet& fieldsSource, FieldSet& fieldsTarget ) const {
     ATLAS_TRACE( "atlas::interpolation::method::Method::do_execute()" );
 
     const idx_t N = fieldsSource.size();
     ATLAS_ASSERT( N == fieldsTarget.size() );
 
-    for ( idx_t i = 0; i < fieldsSource.size(); ++i ) {
+    // Fields without non-linear corrections are interpolated together per data type, in a single pass over the matrix
+    std::vector<Field> src_double, tgt_double, src_float, tgt_float;
+    std::vector<idx_t> remaining;
+    for ( idx_t i = 0; i < N; ++i ) {
+        const Field& src = fieldsSource[i];
+        Field& tgt       = fieldsTarget[i];
+        if ( N > 1 && batchable( src, tgt ) ) {
+            if ( src.datatype().kind() == array::DataType::KIND_REAL64 ) {
+                src_double.emplace_back( src );
+                tgt_double.emplace_back( tgt );
+            }
+            else {
+                src_float.emplace_back( src );
+                tgt_float.emplace_back( tgt );
+            }
+        }
+        else {
+            remaining.emplace_back( i );
+        }
+    }
+
+    if ( src_double.size() + src_float.size() > 0 ) {
+        FieldSet batch;
+        for ( auto& field : src_double ) {
+            batch.add( field );
+        }
+        for ( auto& field : src_float ) {
+            batch.add( field );
+        }
+        haloExchange( batch );
+
+        if ( src_double.size() ) {
+            interpolate_fields_batched<double>( src_double, tgt_double, *matrix_ );
+        }
+        if ( src_float.size() ) {
+            interpolate_fields_batched<float>( src_float, tgt_float, *matrix_ );
+        }
+
+        auto finalise = []( const std::vector<Field>& src, std::vector<Field>& tgt ) {
+            for ( size_t i = 0; i < src.size(); ++i ) {
+                // carry over missing value metadata
+                field::MissingValue mv( src[i] );
+                if ( mv ) {
+                    mv.metadata( tgt[i] );
+                }
+                tgt[i].set_dirty();
+            }
+        };
+        finalise( src_double, tgt_double );
+        finalise( src_float, tgt_float );
+    }
+
+    for ( idx_t i : remaining ) {
         Log::debug() << "Method::do_execute() on field " << ( i + 1 ) << '/' << N << "..." << std::endl;
         Method::do_execute( fieldsSource[i], fieldsTarget[i] );
     }
@@ -167,23 +335,31 @@ void Method::do_execute( const Field& src, Field& tgt ) const {
 
     haloExchange( src );
 
-    // non-linearities: a non-empty M matrix contains the corrections applied to matrix_
+    // non-linearities: corrections are preferably applied on the fly (masked multiplication), otherwise
+    // a non-empty M matrix contains the corrections applied to matrix_
     Matrix M;
+    bool interpolated = false;
     if ( !matrix_->empty() && nonLinear_( src ) ) {
-        Matrix W( *matrix_ );  // copy (a big penalty -- copy-on-write would definitely be better)
-        if ( nonLinear_->execute( W, src ) ) {
-            M.swap( W );
+        check_compatibility( src, tgt, *matrix_ );
+        interpolated = nonLinear_.interpolate( *matrix_, src, tgt );
+        if ( !interpolated ) {
+            Matrix W( *matrix_ );  // copy (a big penalty -- copy-on-write would definitely be better)
+            if ( nonLinear_->execute( W, src ) ) {
+                M.swap( W );
+            }
         }
     }
 
-    if ( src.datatype().kind() == array::DataType::KIND_REAL64 ) {
-        interpolate_field<double>( src, tgt, M.empty() ? *matrix_ : M );
-    }
-    else if ( src.datatype().kind() == array::DataType::KIND_REAL32 ) {
-        interpolate_field<float>( src, tgt, M.empty() ? *matrix_ : M );
-    }
-    else {
-        ATLAS_NOTIMPLEMENTED;
+    if ( !interpolated ) {
+        if ( src.datatype().kind() == array::DataType::KIND_REAL64 ) {
+            interpolate_field<double>( src, tgt, M.empty() ? *matrix_ : M );
+        }
+        else if ( src.datatype().kind() == array::DataType::KIND_REAL32 ) {
+            interpolate_field<float>( src, tgt, M.empty() ? *matrix_ : M );
+        }
+        else {
+            ATLAS_NOTIMPLEMENTED;
+        }
     }
 
     // carry over missing value metadata
@@ -212,8 +388,17 @@ void Method::normalise( Triplets& triplets ) {
 }
 
 void Method::haloExchange( const FieldSet& fields ) const {
+    if ( !allow_halo_exchange_ ) {
+        return;
+    }
+    FieldSet dirty;
     for ( auto& field : fields ) {
-        haloExchange( field );
+        if ( field.dirty() ) {
+            dirty.add( field );
+        }
+    }
+    if ( dirty.size() ) {
+        source().haloExchange( dirty );
     }
 }
 void Method::haloExchange( const Field& field ) const {
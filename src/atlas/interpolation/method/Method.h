@@ -86,6 +86,8 @@ protected:
     NonLinear nonLinear_;
     bool use_eckit_linalg_spmv_;
     bool allow_halo_exchange_{true};
+    std::string matrix_cache_path_;
+    std::string config_hash_;
 
 protected:
     virtual void do_setup( const FunctionSpace& source, const FunctionSpace& target ) = 0;
@@ -94,9 +96,17 @@ protected:
     virtual void do_setup( const FunctionSpace& source, const FieldSet& target );
 
 private:
+    /// @brief Setup with grids, loading the matrix from or storing it to a file in matrix_cache_path_
+    void setup_with_matrix_file( const Grid& source, const Grid& target, const Cache& );
+
     template <typename Value>
     void interpolate_field( const Field& src, Field& tgt, const Matrix& ) const;
 
+    template <typename Value>
+    void interpolate_fields_batched( const std::vector<Field>& src, std::vector<Field>& tgt, const Matrix& ) const;
+
+    bool batchable( const Field& src, const Field& tgt ) const;
+
     template <typename Value>
     void interpolate_field_rank1( const Field& src, Field& tgt, const Matrix& ) const;
 
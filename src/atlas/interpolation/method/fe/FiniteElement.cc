@@ -8,14 +8,16 @@
  * nor does it submit to any jurisdiction. and Interpolation
  */
 
+#include <algorithm>
 #include <cmath>
+#include <exception>
 #include <iomanip>
 #include <limits>
+#include <sstream>
 
 #include "FiniteElement.h"
 
 #include "eckit/log/Plural.h"
-#include "eckit/log/ProgressTimer.h"
 #include "eckit/log/Seconds.h"
 
 #include "atlas/functionspace/NodeColumns.h"
@@ -33,6 +35,7 @@
 #include "atlas/parallel/GatherScatter.h"
 #include "atlas/parallel/mpi/Buffer.h"
 #include "atlas/parallel/mpi/mpi.h"
+#include "atlas/parallel/omp/omp.h"
 #include "atlas/runtime/Exception.h"
 #include "atlas/runtime/Log.h"
 #include "atlas/runtime/Trace.h"
@@ -234,55 +237,101 @@ void FiniteElement::setup( const FunctionSpace& source ) {
     idx_t Nelements                    = meshSource.cells().size();
     const double maxFractionElemsToTry = 0.2;
 
-    // weights -- one per vertex of element, triangles (3) or quads (4)
-
-    Triplets weights_triplets;                 // structure to fill-in sparse matrix
-    weights_triplets.reserve( out_npts * 4 );  // preallocate space as if all elements where quads
-
     // search nearest k cell centres
 
     const idx_t maxNbElemsToTry = std::max<idx_t>( 64, idx_t( Nelements * maxFractionElemsToTry ) );
-    idx_t max_neighbours        = 0;
 
-    std::vector<size_t> failures;
+    // Target points are distributed over threads in blocks. Each block fills its own triplets, which are
+    // concatenated in block order afterwards, so that the triplets remain sorted by row.
+    struct Block {
+        Triplets triplets;  // weights -- one per vertex of element, triangles (3) or quads (4)
+        std::vector<idx_t> failures;
+        std::vector<std::string> failures_logs;  // one per failure
+        idx_t max_neighbours{0};
+        std::exception_ptr error;  // exceptions cannot leave the parallel region, and are rethrown afterwards
+    };
+    constexpr idx_t block_size = 1024;
+    std::vector<Block> blocks( ( out_npts + block_size - 1 ) / block_size );
+    const idx_t nb_blocks = static_cast<idx_t>( blocks.size() );
 
     ATLAS_TRACE_SCOPE( "Computing interpolation matrix" ) {
-        eckit::ProgressTimer progress( "Computing interpolation weights", out_npts, "point", double( 5 ),
-                                       Log::debug() );
-        for ( idx_t ip = 0; ip < out_npts; ++ip, ++progress ) {
-            if ( out_ghosts( ip ) ) {
-                continue;
-            }
-
-            PointXYZ p{( *ocoords_ )( ip, 0 ), ( *ocoords_ )( ip, 1 ), ( *ocoords_ )( ip, 2 )};  // lookup point
-
-            idx_t kpts   = 1;
-            bool success = false;
-            std::ostringstream failures_log;
-
-            while ( !success && kpts <= maxNbElemsToTry ) {
-                max_neighbours = std::max( kpts, max_neighbours );
+        atlas_omp_parallel_for( idx_t jblock = 0; jblock < nb_blocks; ++jblock ) {
+            Block& block      = blocks[jblock];
+            const idx_t begin = jblock * block_size;
+            const idx_t end   = std::min( begin + block_size, out_npts );
+            try {
+                std::vector<idx_t> pending;
+                pending.reserve( end - begin );
+                for ( idx_t ip = begin; ip < end; ++ip ) {
+                    if ( not out_ghosts( ip ) ) {
+                        pending.emplace_back( ip );
+                    }
+                }
 
-                ElemIndex3::NodeList cs = eTree->kNearestNeighbours( p, kpts );
-                Triplets triplets       = projectPointToElements( ip, cs, failures_log );
+                // The element k-d tree is queried for all pending points of the block in turn, and the number of
+                // nearest elements is doubled only for the points that could not be projected yet
+                std::vector<Triplets> point_triplets( end - begin );
+                std::vector<std::string> point_logs( end - begin );
+                std::vector<idx_t> retry;
+                std::ostringstream failures_log;
+                for ( idx_t kpts = 1; !pending.empty() && kpts <= maxNbElemsToTry; kpts *= 2 ) {
+                    block.max_neighbours = kpts;
+                    retry.clear();
+                    for ( idx_t ip : pending ) {
+                        const PointXYZ p{( *ocoords_ )( ip, 0 ), ( *ocoords_ )( ip, 1 ), ( *ocoords_ )( ip, 2 )};
+
+                        ElemIndex3::NodeList cs = eTree->kNearestNeighbours( p, kpts );
+                        failures_log.str( std::string() );
+                        point_triplets[ip - begin] = projectPointToElements( ip, cs, failures_log );
+                        if ( point_triplets[ip - begin].empty() ) {
+                            point_logs[ip - begin] += failures_log.str();
+                            retry.emplace_back( ip );
+                        }
+                    }
+                    pending.swap( retry );
+                }
 
-                if ( triplets.size() ) {
-                    std::copy( triplets.begin(), triplets.end(), std::back_inserter( weights_triplets ) );
-                    success = true;
+                size_t nb_triplets = 0;
+                for ( const auto& triplets : point_triplets ) {
+                    nb_triplets += triplets.size();
                 }
-                kpts *= 2;
+                block.triplets.reserve( nb_triplets );
+                for ( const auto& triplets : point_triplets ) {
+                    block.triplets.insert( block.triplets.end(), triplets.begin(), triplets.end() );
+                }
+                for ( idx_t ip : pending ) {
+                    block.failures_logs.emplace_back( std::move( point_logs[ip - begin] ) );
+                }
+                block.failures = std::move( pending );
             }
-
-            if ( !success ) {
-                failures.push_back( ip );
-                Log::debug() << "------------------------------------------------------"
-                                "---------------------\n";
-                const PointLonLat pll{out_lonlat( ip, 0 ), out_lonlat( ip, 1 )};
-                Log::debug() << "Failed to project point (lon,lat)=" << pll << '\n';
-                Log::debug() << failures_log.str();
+            catch ( ... ) {
+                block.error = std::current_exception();
             }
         }
     }
+
+    for ( const auto& block : blocks ) {
+        if ( block.error ) {
+            std::rethrow_exception( block.error );
+        }
+    }
+
+    idx_t max_neighbours = 0;
+    size_t nb_triplets   = 0;
+    std::vector<idx_t> failures;
+    for ( const auto& block : blocks ) {
+        max_neighbours = std::max( max_neighbours, block.max_neighbours );
+        nb_triplets += block.triplets.size();
+        for ( size_t j = 0; j < block.failures.size(); ++j ) {
+            const idx_t ip = block.failures[j];
+            failures.emplace_back( ip );
+            Log::debug() << "------------------------------------------------------"
+                            "---------------------\n";
+            const PointLonLat pll{out_lonlat( ip, 0 ), out_lonlat( ip, 1 )};
+            Log::debug() << "Failed to project point (lon,lat)=" << pll << '\n';
+            Log::debug() << block.failures_logs[j];
+        }
+    }
     Log::debug() << "Maximum neighbours searched was " << eckit::Plural( max_neighbours, "element" ) << std::endl;
 
     eckit::mpi::comm().barrier();
@@ -290,8 +339,8 @@ void FiniteElement::setup( const FunctionSpace& source ) {
         // If this fails, consider lowering atlas::grid::parametricEpsilon
         std::ostringstream msg;
         msg << "Rank " << mpi::rank() << " failed to project points:\n";
-        for ( std::vector<size_t>::const_iterator i = failures.begin(); i != failures.end(); ++i ) {
-            const PointLonLat pll{out_lonlat( *i, (size_t)0 ), out_lonlat( *i, (size_t)1 )};  // lookup point
+        for ( idx_t ip : failures ) {
+            const PointLonLat pll{out_lonlat( ip, 0 ), out_lonlat( ip, 1 )};  // lookup point
             msg << "\t(lon,lat) = " << pll << "\n";
         }
 
@@ -299,6 +348,13 @@ void FiniteElement::setup( const FunctionSpace& source ) {
         throw_Exception( msg.str() );
     }
 
+    Triplets weights_triplets;  // structure to fill-in sparse matrix
+    weights_triplets.reserve( nb_triplets );
+    for ( auto& block : blocks ) {
+        weights_triplets.insert( weights_triplets.end(), block.triplets.begin(), block.triplets.end() );
+        Triplets().swap( block.triplets );
+    }
+
     // fill sparse matrix and return
     Matrix A( out_npts, inp_npts, weights_triplets );
     matrix_shared_->swap( A );
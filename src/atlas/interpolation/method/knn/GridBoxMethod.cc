@@ -12,14 +12,16 @@
 #include "atlas/interpolation/method/knn/GridBoxMethod.h"
 
 #include <algorithm>
+#include <utility>
 #include <vector>
 
 #include "eckit/log/Plural.h"
-#include "eckit/log/ProgressTimer.h"
 #include "eckit/types/FloatCompare.h"
 
+#include "atlas/array.h"
 #include "atlas/grid.h"
 #include "atlas/parallel/mpi/mpi.h"
+#include "atlas/parallel/omp/omp.h"
 #include "atlas/runtime/Exception.h"
 #include "atlas/runtime/Log.h"
 #include "atlas/runtime/Trace.h"
@@ -51,22 +53,57 @@ void GridBoxMethod::do_setup( const FunctionSpace& /*source*/, const FunctionSpa
 
 bool GridBoxMethod::intersect( size_t i, const GridBox& box, const util::IndexKDTree::ValueList& closest,
                                std::vector<eckit::linalg::Triplet>& triplets ) const {
-    ASSERT( !closest.empty() );
+    const char* invalid = nullptr;
+    if ( intersectBoxes( i, box, closest, triplets, invalid ) ) {
+        return true;
+    }
+    if ( invalid ) {
+        throw_AssertionFailed( invalid, Here() );
+    }
 
+    if ( failEarly_ ) {
+        Log::error() << "Failed to intersect grid box " << i << ", " << box << std::endl;
+        throw_Exception( "Failed to intersect grid box" );
+    }
+
+    failures_.push_front( i );
+    return false;
+}
+
+bool GridBoxMethod::intersectBoxes( size_t i, const GridBox& box, const util::IndexKDTree::ValueList& closest,
+                                    std::vector<eckit::linalg::Triplet>& triplets, const char*& invalid ) const {
+    invalid = nullptr;
     triplets.clear();
+
+    if ( closest.empty() ) {
+        invalid = "!closest.empty()";
+        return false;
+    }
     triplets.reserve( closest.size() );
 
     double area = box.area();
-    ASSERT( area > 0. );
+    if ( not( area > 0. ) ) {
+        invalid = "area > 0.";
+        return false;
+    }
 
     double sumSmallAreas = 0.;
     for ( auto& c : closest ) {
-        auto j        = c.payload();
-        auto smallBox = sourceBoxes_.at( j );
+        auto j = c.payload();
+        if ( j >= sourceBoxes_.size() ) {
+            triplets.clear();
+            invalid = "j < sourceBoxes_.size()";
+            return false;
+        }
+        const auto& smallBox = sourceBoxes_[j];
 
         if ( box.intersects( smallBox ) ) {
             double smallArea = smallBox.area();
-            ASSERT( smallArea > 0. );
+            if ( not( smallArea > 0. ) ) {
+                triplets.clear();
+                invalid = "smallArea > 0.";
+                return false;
+            }
 
             triplets.emplace_back( i, j, smallArea / area );
             sumSmallAreas += smallArea;
@@ -77,12 +114,6 @@ bool GridBoxMethod::intersect( size_t i, const GridBox& box, const util::IndexKD
         }
     }
 
-    if ( failEarly_ ) {
-        Log::error() << "Failed to intersect grid box " << i << ", " << box << std::endl;
-        throw_Exception( "Failed to intersect grid box" );
-    }
-
-    failures_.push_front( i );
     triplets.clear();
     return false;
 }
@@ -113,7 +144,7 @@ void GridBoxMethod::do_setup( const Grid& source, const Grid& target, const Cach
         return;
     }
 
-    if ( not extractTreeFromCache( cache ) ) {
+    if ( not extractTreeFromCache( cache ) && not extractTreeFromFileCache( source ) ) {
         buildPointSearchTree( src );
     }
 
@@ -134,24 +165,76 @@ void GridBoxMethod::do_setup( const Grid& source, const Grid& target, const Cach
     {
         ATLAS_TRACE( "GridBoxMethod::setup: intersecting grid boxes" );
 
-        eckit::ProgressTimer progress( "Intersecting", targetBoxes_.size(), "grid box", double( 5. ) );
-
-        std::vector<Triplet> triplets;
-        size_t i = 0;
-        for ( auto p : tgt.iterate().lonlat() ) {
-            ++progress;
-
-            if ( intersect( i, targetBoxes_.at( i ), pTree_.closestPointsWithinRadius( p, searchRadius_ ),
-                            triplets ) ) {
-                std::copy( triplets.begin(), triplets.end(), std::back_inserter( allTriplets ) );
+        // Each thread collects the triplets of its rows, and the number of triplets of every row is recorded, so
+        // that the triplets can afterwards be moved directly to their position in row order
+        const size_t nb_rows = targetBoxes_.size();
+        const auto lonlat    = array::make_view<double, 2>( tgt.lonlat() );
+        std::vector<size_t> row_counts( nb_rows, 0 );
+        std::vector<std::vector<Triplet>> thread_triplets( atlas_omp_get_max_threads() );
+        std::vector<std::vector<size_t>> thread_failures( atlas_omp_get_max_threads() );
+
+        // Invalid input cannot be thrown from within the parallel region; the first row with invalid input of each
+        // thread is recorded instead, and thrown for afterwards
+        std::vector<std::pair<size_t, const char*>> thread_invalid( atlas_omp_get_max_threads(), {nb_rows, nullptr} );
+
+        atlas_omp_parallel {
+            auto& triplets_of_thread = thread_triplets[atlas_omp_get_thread_num()];
+            auto& failures_of_thread = thread_failures[atlas_omp_get_thread_num()];
+            auto& invalid_of_thread  = thread_invalid[atlas_omp_get_thread_num()];
+            std::vector<Triplet> triplets;
+            const char* invalid = nullptr;
+            atlas_omp_for( size_t i = 0; i < nb_rows; ++i ) {
+                const PointLonLat p{lonlat( i, 0 ), lonlat( i, 1 )};
+                if ( intersectBoxes( i, targetBoxes_[i], pTree_.closestPointsWithinRadius( p, searchRadius_ ),
+                                     triplets, invalid ) ) {
+                    row_counts[i] = triplets.size();
+                    triplets_of_thread.insert( triplets_of_thread.end(), triplets.begin(), triplets.end() );
+                }
+                else if ( invalid ) {
+                    if ( not invalid_of_thread.second ) {
+                        invalid_of_thread = {i, invalid};
+                    }
+                }
+                else {
+                    failures_of_thread.emplace_back( i );
+                }
             }
+        }
 
-            ++i;
+        const auto invalid = std::min_element( thread_invalid.begin(), thread_invalid.end() );
+        if ( invalid->second ) {
+            Log::error() << "Invalid grid box " << invalid->first << ", " << targetBoxes_.at( invalid->first )
+                         << std::endl;
+            throw_AssertionFailed( invalid->second, Here() );
         }
 
+        for ( const auto& failures : thread_failures ) {
+            for ( size_t i : failures ) {
+                failures_.push_front( i );
+            }
+        }
         if ( !failures_.empty() ) {
+            if ( failEarly_ ) {
+                const size_t i = *std::min_element( failures_.begin(), failures_.end() );
+                Log::error() << "Failed to intersect grid box " << i << ", " << targetBoxes_.at( i ) << std::endl;
+                throw_Exception( "Failed to intersect grid box" );
+            }
             giveUp( failures_ );
         }
+
+        std::vector<size_t> row_offsets( nb_rows + 1, 0 );
+        for ( size_t i = 0; i < nb_rows; ++i ) {
+            row_offsets[i + 1] = row_offsets[i] + row_counts[i];
+        }
+
+        allTriplets.resize( row_offsets.back() );
+        atlas_omp_parallel_for( size_t t = 0; t < thread_triplets.size(); ++t ) {
+            // rows are disjoint between threads, so that every offset is only advanced by one thread
+            for ( const auto& triplet : thread_triplets[t] ) {
+                allTriplets[row_offsets[triplet.row()]++] = triplet;
+            }
+            std::vector<Triplet>().swap( thread_triplets[t] );
+        }
     }
 
     {
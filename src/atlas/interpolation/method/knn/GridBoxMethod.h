@@ -45,6 +45,12 @@ protected:
 
     bool intersect( size_t i, const GridBox& iBox, const util::IndexKDTree::ValueList&, std::vector<Triplet>& ) const;
 
+    /// @brief Triplets of the intersection of a target grid box with the closest source grid boxes
+    /// @return false if the intersection does not cover the target grid box; failures are not recorded and invalid
+    /// input is returned in invalid rather than thrown, so that this may be called concurrently
+    bool intersectBoxes( size_t i, const GridBox& iBox, const util::IndexKDTree::ValueList&, std::vector<Triplet>&,
+                         const char*& invalid ) const;
+
     virtual void do_execute( const FieldSet& source, FieldSet& target ) const override = 0;
     virtual void do_execute( const Field& source, Field& target ) const override       = 0;
 
@@ -10,10 +10,8 @@
 
 #include "atlas/interpolation/method/knn/KNearestNeighbours.h"
 
-#include <limits>
-
-#include "eckit/log/Plural.h"
-#include "eckit/types/FloatCompare.h"
+#include <algorithm>
+#include <utility>
 
 #include "atlas/array.h"
 #include "atlas/functionspace/NodeColumns.h"
@@ -23,6 +21,7 @@
 #include "atlas/mesh/actions/BuildXYZField.h"
 #include "atlas/meshgenerator.h"
 #include "atlas/parallel/mpi/mpi.h"
+#include "atlas/parallel/omp/omp.h"
 #include "atlas/runtime/Exception.h"
 #include "atlas/runtime/Log.h"
 #include "atlas/runtime/Trace.h"
@@ -83,49 +82,69 @@ void KNearestNeighbours::do_setup( const FunctionSpace& source, const FunctionSp
     size_t out_npts = meshTarget.nodes().size();
 
     // fill the sparse matrix
-    std::vector<Triplet> weights_triplets;
-    weights_triplets.reserve( out_npts * k_ );
+    // Every row has the same number of non-zero entries, so that each row is written at a fixed offset and the
+    // triplets are sorted by row without further merging
+    const size_t k = std::min( k_, pTree_.size() );
+    ATLAS_ASSERT( k );
+    std::vector<Triplet> weights_triplets( out_npts * k );
     {
-        Trace timer( Here(), "atlas::interpolation::method::NearestNeighbour::do_setup()" );
-
-        std::vector<double> weights;
+        ATLAS_TRACE( "atlas::interpolation::method::NearestNeighbour::do_setup()" );
 
         Log::debug() << "Computing interpolation weights for " << out_npts << " points." << std::endl;
+
+        // find the closest input points to the output points
+        std::vector<PointLonLat> points( out_npts );
         for ( size_t ip = 0; ip < out_npts; ++ip ) {
-            if ( ip && ( ip % 1000 == 0 ) ) {
-                auto elapsed = timer.elapsed();
-                auto rate    = eckit::types::is_approximately_equal( elapsed, 0. )
-                                ? std::numeric_limits<double>::infinity()
-                                : ( ip / elapsed );
-                Log::debug() << eckit::BigNum( ip ) << " (at " << rate << " points/s)..." << std::endl;
+            points[ip] = PointLonLat{lonlat( ip, size_t( LON ) ), lonlat( ip, size_t( LAT ) )};
+        }
+        std::vector<util::IndexKDTree::Payload> nn( out_npts * k );
+        std::vector<double> distances( out_npts * k );
+        pTree_.closestPoints( points.data(), out_npts, k, nn.data(), distances.data() );
+
+        // Invalid results cannot be thrown from within the parallel region; the first invalid point of each thread is
+        // recorded instead, and thrown for afterwards
+        std::vector<std::pair<size_t, const char*>> thread_invalid( atlas_omp_get_max_threads(), {out_npts, nullptr} );
+
+        atlas_omp_parallel {
+            auto& invalid_of_thread = thread_invalid[atlas_omp_get_thread_num()];
+            std::vector<double> weights( k );
+            atlas_omp_for( size_t ip = 0; ip < out_npts; ++ip ) {
+                // calculate weights (individual and total, to normalise) using distance
+                // squared
+                double sum = 0;
+                for ( size_t j = 0; j < k; ++j ) {
+                    const double d  = distances[ip * k + j];
+                    const double d2 = d * d;
+
+                    weights[j] = 1. / ( 1. + d2 );
+                    sum += weights[j];
+                }
+                if ( not( sum > 0 ) ) {
+                    if ( not invalid_of_thread.second ) {
+                        invalid_of_thread = {ip, "sum > 0"};
+                    }
+                    continue;
+                }
+
+                // insert weights into the matrix
+                for ( size_t j = 0; j < k; ++j ) {
+                    size_t jp = static_cast<size_t>( nn[ip * k + j] );
+                    if ( jp >= inp_npts ) {
+                        if ( not invalid_of_thread.second ) {
+                            invalid_of_thread = {
+                                ip, "point found which is not covered within the halo of the source function space"};
+                        }
+                        break;
+                    }
+                    weights_triplets[ip * k + j] = Triplet( ip, jp, weights[j] / sum );
+                }
             }
+        }
 
-            // find the closest input points to the output point
-            auto nn = pTree_.closestPoints( PointLonLat{lonlat( ip, size_t( LON ) ), lonlat( ip, size_t( LAT ) )}, k_ );
-
-            // calculate weights (individual and total, to normalise) using distance
-            // squared
-            const size_t npts = nn.size();
-            ATLAS_ASSERT( npts );
-            weights.resize( npts, 0 );
-
-            double sum = 0;
-            for ( size_t j = 0; j < npts; ++j ) {
-                const double d  = nn[j].distance();
-                const double d2 = d * d;
-
-                weights[j] = 1. / ( 1. + d2 );
-                sum += weights[j];
-            }
-            ATLAS_ASSERT( sum > 0 );
-
-            // insert weights into the matrix
-            for ( size_t j = 0; j < npts; ++j ) {
-                size_t jp = nn[j].payload();
-                ATLAS_ASSERT( jp < inp_npts,
-                              "point found which is not covered within the halo of the source function space" );
-                weights_triplets.emplace_back( ip, jp, weights[j] / sum );
-            }
+        const auto invalid = std::min_element( thread_invalid.begin(), thread_invalid.end() );
+        if ( invalid->second ) {
+            Log::error() << "Could not compute interpolation weights for point " << invalid->first << std::endl;
+            throw_AssertionFailed( invalid->second, Here() );
         }
     }
 
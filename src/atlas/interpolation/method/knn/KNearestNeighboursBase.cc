@@ -13,6 +13,7 @@
 
 #include "atlas/array.h"
 #include "atlas/functionspace/PointCloud.h"
+#include "atlas/grid/Grid.h"
 #include "atlas/interpolation/method/knn/KNearestNeighboursBase.h"
 #include "atlas/library/Library.h"
 #include "atlas/mesh/Nodes.h"
@@ -24,6 +25,12 @@ namespace atlas {
 namespace interpolation {
 namespace method {
 
+KNearestNeighboursBase::KNearestNeighboursBase( const Config& config ) : Method( config ) {
+    static std::string kdtreeCachePath = eckit::Resource<std::string>( "$ATLAS_KDTREE_CACHE_PATH", "" );
+    kdtreeCachePath_                   = kdtreeCachePath;
+    config.get( "kdtree_cache_path", kdtreeCachePath_ );
+}
+
 void KNearestNeighboursBase::buildPointSearchTree( Mesh& meshSource, const mesh::Halo& _halo ) {
     ATLAS_TRACE();
     eckit::TraceTimer<Atlas> tim( "KNearestNeighboursBase::buildPointSearchTree()" );
@@ -89,6 +96,12 @@ bool KNearestNeighboursBase::extractTreeFromCache( const Cache& c ) {
     return false;
 }
 
+bool KNearestNeighboursBase::extractTreeFromFileCache( const Grid& grid ) {
+    if ( kdtreeCachePath_.empty() ) {
+        return false;
+    }
+    return extractTreeFromCache( IndexKDTreeCache( grid, kdtreeCachePath_ ) );
+}
 
 }  // namespace method
 }  // namespace interpolation
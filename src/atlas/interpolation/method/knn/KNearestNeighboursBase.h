@@ -11,6 +11,7 @@
 #pragma once
 
 #include <memory>
+#include <string>
 
 #include "atlas/interpolation/method/Method.h"
 #include "atlas/mesh/Halo.h"
@@ -23,7 +24,7 @@ namespace method {
 
 class KNearestNeighboursBase : public Method {
 public:
-    KNearestNeighboursBase( const Config& config ) : Method( config ) {}
+    KNearestNeighboursBase( const Config& config );
     virtual ~KNearestNeighboursBase() override {}
 
 protected:
@@ -32,7 +33,13 @@ protected:
     void buildPointSearchTree( const FunctionSpace& );
     bool extractTreeFromCache( const Cache& );
 
+    /// @brief Map the tree of the grid points from a file in the directory given by the "kdtree_cache_path" option
+    /// or environment variable ATLAS_KDTREE_CACHE_PATH. The file is created first if needed.
+    /// @return false if no such directory is configured
+    bool extractTreeFromFileCache( const Grid& );
+
     util::IndexKDTree pTree_;
+    std::string kdtreeCachePath_;
 };
 
 }  // namespace method
@@ -16,6 +16,7 @@
 
 #include "atlas/field/MissingValue.h"
 #include "atlas/interpolation/nonlinear/NonLinear.h"
+#include "atlas/parallel/omp/omp.h"
 
 
 namespace atlas {
@@ -26,6 +27,75 @@ namespace nonlinear {
 struct Missing : NonLinear {
 private:
     bool applicable( const Field& f ) const override { return field::MissingValue( f ); }
+
+protected:
+    /**
+     * @brief Masked sparse matrix-vector multiplication: rows without missing values are interpolated as usual,
+     * rows with missing values are either set to missing value (if forceMissing(N_missing, N_entries, sum,
+     * heaviest_is_missing) holds) or linearly re-weighted disregarding missing values
+     */
+    template <typename T, typename ForceMissing>
+    static bool interpolate_masked( const Matrix& W, const Field& src, Field& tgt, ForceMissing forceMissing ) {
+        // NOTE only for scalars (for now)
+        if ( src.rank() != 1 || tgt.rank() != 1 || tgt.datatype() != src.datatype() ) {
+            return false;
+        }
+
+        field::MissingValue mv( src );
+        auto& missingValue = mv.ref();
+
+        auto values = make_view_field_values<T, 1>( src );
+        auto result = array::make_view<T, 1>( tgt );
+        ATLAS_ASSERT( idx_t( W.cols() ) == values.size() );
+        ATLAS_ASSERT( idx_t( W.rows() ) <= result.size() );
+
+        const auto outer = W.outer();
+        const auto inner = W.inner();
+        const auto data  = W.data();
+        const Size rows  = W.rows();
+
+        atlas_omp_parallel_for( Size r = 0; r < rows; ++r ) {
+            // count missing values, accumulate weights and weighted values (disregarding missing values)
+            Size i_missing           = Size( outer[r] );
+            size_t N_missing         = 0;
+            Scalar sum               = 0.;
+            Scalar dot               = 0.;
+            Scalar heaviest          = -1.;
+            bool heaviest_is_missing = false;
+
+            for ( Size i = Size( outer[r] ); i < Size( outer[r + 1] ); ++i ) {
+                const T value   = values[inner[i]];
+                const bool miss = missingValue( value );
+
+                if ( miss ) {
+                    ++N_missing;
+                    i_missing = i;
+                }
+                else {
+                    sum += data[i];
+                    dot += data[i] * value;
+                }
+
+                if ( heaviest < data[i] ) {
+                    heaviest            = data[i];
+                    heaviest_is_missing = miss;
+                }
+            }
+
+            const size_t N_entries = size_t( outer[r + 1] - outer[r] );
+            if ( N_missing == 0 ) {
+                result[r] = T( dot );
+            }
+            else if ( forceMissing( N_missing, N_entries, sum, heaviest_is_missing ) ) {
+                result[r] = values[inner[i_missing]];
+            }
+            else {
+                result[r] = T( dot / sum );
+            }
+        }
+
+        return true;
+    }
 };
 
 
@@ -99,6 +169,14 @@ struct MissingIfAllMissing : Missing {
         return modif;
     }
 
+    bool interpolate( const NonLinear::Matrix& W, const Field& src, Field& tgt ) const override {
+        return interpolate_masked<T>( W, src, tgt,
+                                      []( size_t N_missing, size_t N_entries, Scalar sum, bool /*heaviest_missing*/ ) {
+                                          return N_missing == N_entries ||
+                                                 eckit::types::is_approximately_equal( sum, 0. );
+                                      } );
+    }
+
     static std::string static_type() { return "missing-if-all-missing"; }
 };
 
@@ -160,6 +238,13 @@ struct MissingIfAnyMissing : Missing {
         return modif;
     }
 
+    bool interpolate( const NonLinear::Matrix& W, const Field& src, Field& tgt ) const override {
+        return interpolate_masked<T>(
+            W, src, tgt, []( size_t /*N_missing*/, size_t /*N_entries*/, Scalar /*sum*/, bool /*heaviest_missing*/ ) {
+                return true;
+            } );
+    }
+
     static std::string static_type() { return "missing-if-any-missing"; }
 };
 
@@ -242,6 +327,14 @@ struct MissingIfHeaviestMissing : Missing {
         return modif;
     }
 
+    bool interpolate( const NonLinear::Matrix& W, const Field& src, Field& tgt ) const override {
+        return interpolate_masked<T>( W, src, tgt,
+                                      []( size_t N_missing, size_t N_entries, Scalar sum, bool heaviest_missing ) {
+                                          return N_missing == N_entries || heaviest_missing ||
+                                                 eckit::types::is_approximately_equal( sum, 0. );
+                                      } );
+    }
+
     static std::string static_type() { return "missing-if-heaviest-missing"; }
 };
 
@@ -66,6 +66,15 @@ public:
      */
     virtual bool execute( Matrix& W, const Field& f ) const = 0;
 
+    /**
+     * @brief Interpolate applying non-linear corrections on the fly, without modifying (or copying) the matrix
+     * @param [in] W interpolation matrix
+     * @param [in] src field with missing values information
+     * @param [out] tgt interpolated field
+     * @return if supported for this field (otherwise tgt is untouched, and execute(W, src) should be used instead)
+     */
+    virtual bool interpolate( const Matrix& /*W*/, const Field& /*src*/, Field& /*tgt*/ ) const { return false; }
+
 protected:
     template <typename Value, int Rank>
     static array::ArrayView<typename std::add_const<Value>::type, Rank> make_view_field_values( const Field& field ) {
@@ -37,6 +37,7 @@
 #include "atlas/runtime/Exception.h"
 #include "atlas/runtime/Log.h"
 #include "atlas/runtime/Trace.h"
+#include "atlas/runtime/trace/Timeline.h"
 #include "atlas/util/Config.h"
 
 #if ATLAS_HAVE_TRANS
@@ -90,6 +91,13 @@ int getEnv( const std::string& env, int default_value ) {
     return default_value;
 }
 
+std::string getEnv( const std::string& env, const std::string& default_value ) {
+    if ( ::getenv( env.c_str() ) ) {
+        return ::getenv( env.c_str() );
+    }
+    return default_value;
+}
+
 }  // namespace
 
 //----------------------------------------------------------------------------------------------------------------------
@@ -123,7 +131,8 @@ Library::Library() :
     trace_( getEnv( "ATLAS_TRACE", false ) ),
     trace_memory_( getEnv( "ATLAS_TRACE_MEMORY", false ) ),
     trace_barriers_( getEnv( "ATLAS_TRACE_BARRIERS", false ) ),
-    trace_report_( getEnv( "ATLAS_TRACE_REPORT", false ) ) {}
+    trace_report_( getEnv( "ATLAS_TRACE_REPORT", false ) ),
+    trace_timeline_( getEnv( "ATLAS_TRACE_TIMELINE", std::string() ) ) {}
 
 void Library::registerPlugin( eckit::system::Plugin& plugin ) {
     plugins_.push_back( &plugin );
@@ -177,7 +186,9 @@ void Library::initialise( const eckit::Parametrisation& config ) {
         config.get( "trace.barriers", trace_barriers_ );
         config.get( "trace.report", trace_report_ );
         config.get( "trace.memory", trace_memory_ );
+        config.get( "trace.timeline", trace_timeline_ );
     }
+    runtime::trace::Timeline::enable( ATLAS_HAVE_TRACE && not trace_timeline_.empty() );
 
     if ( not debug_ ) {
         debug_channel_.reset();
@@ -220,6 +231,7 @@ void Library::initialise( const eckit::Parametrisation& config ) {
         out << "  trace.barriers  [" << str( traceBarriers() ) << "] \n";
         out << "  trace.report    [" << str( trace_report_ ) << "] \n";
         out << "  trace.memory    [" << str( trace_memory_ ) << "] \n";
+        out << "  trace.timeline  [" << trace_timeline_ << "] \n";
         out << " \n";
         out << atlas::Library::instance().information();
         out << std::flush;
@@ -235,6 +247,10 @@ void Library::finalise() {
     if ( ATLAS_HAVE_TRACE && trace_report_ ) {
         Log::info() << atlas::Trace::report() << std::endl;
     }
+    if ( runtime::trace::Timeline::enabled() ) {
+        runtime::trace::Timeline::write( trace_timeline_ );
+        Log::info() << "Trace timeline written to " << trace_timeline_ << std::endl;
+    }
 
     if ( getEnv( "ATLAS_FINALISES_MPI", false ) ) {
         Log::debug() << "ATLAS_FINALISES_MPI is set: calling atlas::mpi::finalize()" << std::endl;
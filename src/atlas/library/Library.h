@@ -71,6 +71,7 @@ public:
 
     bool traceBarriers() const { return trace_barriers_; }
     bool traceMemory() const { return trace_memory_; }
+    const std::string& traceTimeline() const { return trace_timeline_; }
 
     Library();
 
@@ -87,6 +88,7 @@ protected:
     bool trace_memory_{false};
     bool trace_barriers_{false};
     bool trace_report_{false};
+    std::string trace_timeline_;
     mutable std::unique_ptr<eckit::Channel> info_channel_;
     mutable std::unique_ptr<eckit::Channel> warning_channel_;
     mutable std::unique_ptr<eckit::Channel> trace_channel_;
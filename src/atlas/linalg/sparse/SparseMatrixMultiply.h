@@ -10,6 +10,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include "eckit/config/Configuration.h"
 #include "eckit/linalg/SparseMatrix.h"
 
@@ -38,6 +40,16 @@ template <typename Matrix, typename SourceView, typename TargetView>
 void sparse_matrix_multiply( const Matrix& matrix, const SourceView& src, TargetView& tgt, Indexing,
                              const Configuration& config );
 
+/// @brief Apply one matrix to several (rank 2, layout_left) source/target view pairs in a single pass over the
+/// matrix rows, so that matrix indices and weights are streamed from memory only once
+template <typename SourceValue, typename TargetValue>
+void sparse_matrix_multiply_batched( const SparseMatrix& matrix, const std::vector<View<SourceValue, 2>>& src,
+                                     std::vector<View<TargetValue, 2>>& tgt );
+
+template <typename SourceValue, typename TargetValue>
+void sparse_matrix_multiply_batched( const SparseMatrix& matrix, const std::vector<View<SourceValue, 2>>& src,
+                                     std::vector<View<TargetValue, 2>>& tgt, const Configuration& config );
+
 class SparseMatrixMultiply {
 public:
     SparseMatrixMultiply() = default;
@@ -70,6 +82,16 @@ struct SparseMatrixMultiply {
         throw_NotImplemented( "SparseMatrixMultiply needs a template specialization with the implementation", Here() );
     }
 };
+
+// Template class which needs specialization for concrete backends supporting batched multiplication
+template <typename Backend, typename SourceValue, typename TargetValue>
+struct SparseMatrixMultiplyBatched {
+    static void apply( const SparseMatrix&, const std::vector<View<SourceValue, 2>>&,
+                       std::vector<View<TargetValue, 2>>&, const Configuration& ) {
+        throw_NotImplemented( "SparseMatrixMultiplyBatched needs a template specialization with the implementation",
+                              Here() );
+    }
+};
 }  // namespace sparse
 
 }  // namespace linalg
@@ -96,6 +96,30 @@ void sparse_matrix_multiply( const Matrix& matrix, const SourceView& src, Target
     sparse_matrix_multiply( matrix, src, tgt, Indexing::layout_left );
 }
 
+template <typename SourceValue, typename TargetValue>
+void sparse_matrix_multiply_batched( const SparseMatrix& matrix, const std::vector<View<SourceValue, 2>>& src,
+                                     std::vector<View<TargetValue, 2>>& tgt, const eckit::Configuration& config ) {
+    ATLAS_ASSERT( src.size() == tgt.size() );
+    std::string type = config.getString( "type", sparse::current_backend() );
+    if ( type == sparse::backend::omp::type() ) {
+        using Source = const typename std::remove_const<SourceValue>::type;
+        sparse::SparseMatrixMultiplyBatched<sparse::backend::omp, Source, TargetValue>::apply( matrix, src, tgt,
+                                                                                               config );
+    }
+    else {
+        // Backend without batched support: one multiplication per view pair
+        for ( size_t i = 0; i < src.size(); ++i ) {
+            sparse_matrix_multiply( matrix, src[i], tgt[i], Indexing::layout_left, config );
+        }
+    }
+}
+
+template <typename SourceValue, typename TargetValue>
+void sparse_matrix_multiply_batched( const SparseMatrix& matrix, const std::vector<View<SourceValue, 2>>& src,
+                                     std::vector<View<TargetValue, 2>>& tgt ) {
+    sparse_matrix_multiply_batched( matrix, src, tgt, sparse::Backend() );
+}
+
 }  // namespace linalg
 }  // namespace atlas
 
@@ -175,13 +175,52 @@ void SparseMatrixMultiply<backend::omp, Indexing::layout_right, 3, SourceValue,
     }
 }
 
+template <typename SourceValue, typename TargetValue>
+void SparseMatrixMultiplyBatched<backend::omp, SourceValue, TargetValue>::apply(
+    const SparseMatrix& W, const std::vector<View<SourceValue, 2>>& src, std::vector<View<TargetValue, 2>>& tgt,
+    const Configuration& ) {
+    using Value          = TargetValue;
+    const auto outer     = W.outer();
+    const auto index     = W.inner();
+    const auto weight    = W.data();
+    const idx_t rows     = static_cast<idx_t>( W.rows() );
+    const size_t nfields = src.size();
+
+    ATLAS_ASSERT( tgt.size() == nfields );
+    for ( size_t f = 0; f < nfields; ++f ) {
+        ATLAS_ASSERT( src[f].shape( 0 ) >= W.cols() );
+        ATLAS_ASSERT( tgt[f].shape( 0 ) >= W.rows() );
+        ATLAS_ASSERT( tgt[f].shape( 1 ) == src[f].shape( 1 ) );
+    }
+
+    // The row structure (indices and weights) stays in cache while it is applied to all fields
+    atlas_omp_parallel_for( idx_t r = 0; r < rows; ++r ) {
+        for ( size_t f = 0; f < nfields; ++f ) {
+            const auto& s  = src[f];
+            auto& t        = tgt[f];
+            const idx_t Nk = s.shape( 1 );
+            for ( idx_t k = 0; k < Nk; ++k ) {
+                t( r, k ) = 0.;
+            }
+            for ( idx_t c = outer[r]; c < outer[r + 1]; ++c ) {
+                idx_t n = index[c];
+                Value w = static_cast<Value>( weight[c] );
+                for ( idx_t k = 0; k < Nk; ++k ) {
+                    t( r, k ) += w * s( n, k );
+                }
+            }
+        }
+    }
+}
+
 #define EXPLICIT_TEMPLATE_INSTANTIATION( TYPE )                                                      \
     template struct SparseMatrixMultiply<backend::omp, Indexing::layout_left, 1, TYPE const, TYPE>;  \
     template struct SparseMatrixMultiply<backend::omp, Indexing::layout_left, 2, TYPE const, TYPE>;  \
     template struct SparseMatrixMultiply<backend::omp, Indexing::layout_left, 3, TYPE const, TYPE>;  \
     template struct SparseMatrixMultiply<backend::omp, Indexing::layout_right, 1, TYPE const, TYPE>; \
     template struct SparseMatrixMultiply<backend::omp, Indexing::layout_right, 2, TYPE const, TYPE>; \
-    template struct SparseMatrixMultiply<backend::omp, Indexing::layout_right, 3, TYPE const, TYPE>;
+    template struct SparseMatrixMultiply<backend::omp, Indexing::layout_right, 3, TYPE const, TYPE>; \
+    template struct SparseMatrixMultiplyBatched<backend::omp, TYPE const, TYPE>;
 
 EXPLICIT_TEMPLATE_INSTANTIATION( double );
 EXPLICIT_TEMPLATE_INSTANTIATION( float );
@@ -53,6 +53,12 @@ struct SparseMatrixMultiply<backend::omp, Indexing::layout_right, 3, SourceValue
                        const Configuration& );
 };
 
+template <typename SourceValue, typename TargetValue>
+struct SparseMatrixMultiplyBatched<backend::omp, SourceValue, TargetValue> {
+    static void apply( const SparseMatrix& W, const std::vector<View<SourceValue, 2>>& src,
+                       std::vector<View<TargetValue, 2>>& tgt, const Configuration& );
+};
+
 }  // namespace sparse
 }  // namespace linalg
 }  // namespace atlas
@@ -0,0 +1,371 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include "atlas/mesh/Checkpoint.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <vector>
+
+#include "eckit/filesystem/PathName.h"
+#include "eckit/io/ResizableBuffer.h"
+#include "eckit/log/JSON.h"
+#include "eckit/serialisation/MemoryStream.h"
+#include "eckit/serialisation/ResizableMemoryStream.h"
+
+#include "atlas/field/Field.h"
+#include "atlas/grid/Grid.h"
+#include "atlas/mesh/ElementType.h"
+#include "atlas/mesh/HybridElements.h"
+#include "atlas/mesh/Mesh.h"
+#include "atlas/mesh/Nodes.h"
+#include "atlas/projection/Projection.h"
+#include "atlas/runtime/Exception.h"
+#include "atlas/runtime/Log.h"
+#include "atlas/runtime/Trace.h"
+#include "atlas/util/Config.h"
+#include "atlas/util/Metadata.h"
+
+namespace atlas {
+namespace mesh {
+
+//----------------------------------------------------------------------------------------------------------------------
+
+namespace {
+
+constexpr char magic[8]           = {'A', 'T', 'L', 'A', 'S', 'C', 'K', 'P'};
+constexpr std::uint64_t version   = 1;
+constexpr std::uint64_t alignment = 64;
+
+std::uint64_t aligned( std::uint64_t offset ) {
+    return ( offset + alignment - 1 ) / alignment * alignment;
+}
+
+/// Blocks of bytes of the data section, each starting at an aligned offset
+class DataWriter {
+public:
+    /// @return offset of the block in the data section
+    std::uint64_t add( const void* data, size_t bytes ) {
+        const std::uint64_t offset = size_;
+        blocks_.emplace_back( static_cast<const char*>( data ), bytes );
+        size_ = aligned( offset + bytes );
+        return offset;
+    }
+
+    void write( std::ostream& out ) const {
+        static const char padding[alignment] = {0};
+        for ( const auto& block : blocks_ ) {
+            out.write( block.first, block.second );
+            out.write( padding, aligned( block.second ) - block.second );
+        }
+    }
+
+private:
+    std::vector<std::pair<const char*, size_t>> blocks_;
+    std::uint64_t size_{0};
+};
+
+/// Read-only mapping of a complete file
+class MappedFile {
+public:
+    MappedFile( const eckit::PathName& path ) {
+        int fd = ::open( path.localPath(), O_RDONLY );
+        if ( fd < 0 ) {
+            throw_CantOpenFile( path.asString() + ": " + std::strerror( errno ), Here() );
+        }
+        struct stat st;
+        if ( ::fstat( fd, &st ) != 0 ) {
+            int err = errno;
+            ::close( fd );
+            throw_Exception( "Could not stat file " + path.asString() + ": " + std::strerror( err ), Here() );
+        }
+        size_         = static_cast<size_t>( st.st_size );
+        void* address = ::mmap( nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0 );
+        int err       = errno;
+        // The mapping remains valid after closing the file descriptor
+        ::close( fd );
+        if ( address == MAP_FAILED ) {
+            throw_Exception( "Could not map file " + path.asString() + ": " + std::strerror( err ), Here() );
+        }
+        address_ = static_cast<const char*>( address );
+    }
+
+    ~MappedFile() { ::munmap( const_cast<char*>( address_ ), size_ ); }
+
+    const char* address() const { return address_; }
+    size_t size() const { return size_; }
+
+private:
+    const char* address_;
+    size_t size_;
+};
+
+std::string to_json( const eckit::Configuration& config ) {
+    std::stringstream s;
+    eckit::JSON json( s );
+    json.precision( 17 );
+    json << config;
+    return s.str();
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+/// Connectivity tables are serialised with their own encode() into a buffer that is kept alive until written
+struct EncodedConnectivities {
+    std::vector<std::unique_ptr<eckit::ResizableBuffer>> buffers;
+
+    template <typename Connectivity>
+    util::Config add( DataWriter& data, const Connectivity& connectivity ) {
+        buffers.emplace_back( new eckit::ResizableBuffer( 1024 ) );
+        eckit::ResizableMemoryStream stream( *buffers.back() );
+        connectivity.encode( stream );
+        const size_t bytes = stream.position();
+        util::Config config;
+        config.set( "name", connectivity.name() );
+        config.set( "offset", static_cast<long>( data.add( buffers.back()->data(), bytes ) ) );
+        config.set( "bytes", static_cast<long>( bytes ) );
+        return config;
+    }
+};
+
+template <typename FieldContainer>
+std::vector<util::Config> encode_fields( DataWriter& data, const FieldContainer& container ) {
+    std::vector<util::Config> fields;
+    for ( idx_t f = 0; f < container.nb_fields(); ++f ) {
+        const Field& field = container.field( f );
+        ATLAS_ASSERT( field.contiguous(), "Field " + field.name() + " is not contiguous" );
+        std::vector<long> shape( field.shape().begin(), field.shape().end() );
+        const size_t bytes = field.size() * field.datatype().size();
+
+        util::Config config;
+        config.set( "name", field.name() );
+        config.set( "datatype", field.datatype().str() );
+        config.set( "shape", shape );
+        config.set( "metadata", field.metadata() );
+        config.set( "offset", static_cast<long>( data.add( field.array().storage(), bytes ) ) );
+        config.set( "bytes", static_cast<long>( bytes ) );
+        fields.emplace_back( config );
+    }
+    return fields;
+}
+
+util::Config encode_elements( DataWriter& data, EncodedConnectivities& connectivities,
+                              const HybridElements& elements ) {
+    std::vector<util::Config> types;
+    for ( idx_t t = 0; t < elements.nb_types(); ++t ) {
+        types.emplace_back( util::Config( "name", elements.element_type( t ).name() ) |
+                            util::Config( "size", static_cast<long>( elements.elements( t ).size() ) ) );
+    }
+    util::Config config;
+    config.set( "types", types );
+    config.set( "fields", encode_fields( data, elements ) );
+    config.set( "connectivities", std::vector<util::Config>{connectivities.add( data, elements.node_connectivity() ),
+                                                            connectivities.add( data, elements.edge_connectivity() ),
+                                                            connectivities.add( data, elements.cell_connectivity() )} );
+    return config;
+}
+
+util::Config encode_nodes( DataWriter& data, EncodedConnectivities& connectivities, const Nodes& nodes ) {
+    util::Config config;
+    config.set( "size", static_cast<long>( nodes.size() ) );
+    config.set( "metadata", nodes.metadata() );
+    config.set( "fields", encode_fields( data, nodes ) );
+    config.set( "connectivities", std::vector<util::Config>{connectivities.add( data, nodes.edge_connectivity() ),
+                                                            connectivities.add( data, nodes.cell_connectivity() )} );
+    return config;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+template <typename FieldContainer>
+void decode_fields( const char* data, const util::Config& config, FieldContainer& container ) {
+    std::vector<util::Config> fields;
+    config.get( "fields", fields );
+    for ( const auto& field_config : fields ) {
+        const std::string name = field_config.getString( "name" );
+        const array::DataType datatype( field_config.getString( "datatype" ) );
+        const std::vector<long> shape_config = field_config.getLongVector( "shape" );
+        array::ArrayShape shape( std::vector<idx_t>( shape_config.begin(), shape_config.end() ) );
+
+        if ( not container.has_field( name ) ) {
+            container.add( Field( name, datatype, shape ) );
+        }
+        Field field = container.field( name );
+        ATLAS_ASSERT( field.datatype() == datatype );
+        ATLAS_ASSERT( field.shape() == shape );
+
+        const size_t bytes = static_cast<size_t>( field_config.getLong( "bytes" ) );
+        ATLAS_ASSERT( bytes == field.size() * datatype.size() );
+        std::memcpy( field.storage(), data + field_config.getLong( "offset" ), bytes );
+
+        util::Config metadata;
+        field_config.get( "metadata", metadata );
+        field.metadata() = util::Metadata( metadata );
+    }
+}
+
+template <typename Connectivity>
+void decode_connectivity( const char* data, const util::Config& config, Connectivity& connectivity ) {
+    ATLAS_ASSERT( config.getString( "name" ) == connectivity.name() );
+    eckit::MemoryStream stream( data + config.getLong( "offset" ), config.getLong( "bytes" ) );
+    connectivity.decode( stream );
+}
+
+void decode_elements( const char* data, const util::Config& config, HybridElements& elements ) {
+    std::vector<util::Config> types;
+    config.get( "types", types );
+    for ( const auto& type : types ) {
+        elements.add( ElementType::create( type.getString( "name" ) ), type.getLong( "size" ) );
+    }
+    decode_fields( data, config, elements );
+
+    std::vector<util::Config> connectivities;
+    config.get( "connectivities", connectivities );
+    ATLAS_ASSERT( connectivities.size() == 3 );
+    decode_connectivity( data, connectivities[0], elements.node_connectivity() );
+    decode_connectivity( data, connectivities[1], elements.edge_connectivity() );
+    decode_connectivity( data, connectivities[2], elements.cell_connectivity() );
+}
+
+void decode_nodes( const char* data, const util::Config& config, Nodes& nodes ) {
+    nodes.resize( config.getLong( "size" ) );
+    util::Config metadata;
+    config.get( "metadata", metadata );
+    nodes.metadata() = util::Metadata( metadata );
+    decode_fields( data, config, nodes );
+
+    std::vector<util::Config> connectivities;
+    config.get( "connectivities", connectivities );
+    ATLAS_ASSERT( connectivities.size() == 2 );
+    decode_connectivity( data, connectivities[0], nodes.edge_connectivity() );
+    decode_connectivity( data, connectivities[1], nodes.cell_connectivity() );
+}
+
+}  // namespace
+
+//----------------------------------------------------------------------------------------------------------------------
+
+eckit::PathName Checkpoint::path( const eckit::PathName& path, idx_t part ) {
+    return eckit::PathName( path.asString() + ".p" + std::to_string( part ) );
+}
+
+void Checkpoint::write( const Mesh& mesh, const eckit::PathName& file_path ) {
+    ATLAS_TRACE( "mesh::Checkpoint::write" );
+    const eckit::PathName file = path( file_path );
+    Log::debug() << "Writing mesh checkpoint " << file << std::endl;
+
+    DataWriter data;
+    EncodedConnectivities connectivities;
+
+    util::Config header;
+    header.set( "mpi_size", static_cast<long>( mpi::size() ) );
+    header.set( "mpi_rank", static_cast<long>( mpi::rank() ) );
+    header.set( "sizeof_idx_t", static_cast<long>( sizeof( idx_t ) ) );
+    header.set( "metadata", mesh.metadata() );
+    if ( mesh.grid() ) {
+        header.set( "grid", mesh.grid().spec() );
+    }
+    if ( mesh.projection() ) {
+        header.set( "projection", mesh.projection().spec() );
+    }
+    header.set( "nodes", encode_nodes( data, connectivities, mesh.nodes() ) );
+    header.set( "cells", encode_elements( data, connectivities, mesh.cells() ) );
+    header.set( "edges", encode_elements( data, connectivities, mesh.edges() ) );
+    const std::string json = to_json( header );
+
+    // The file is written under a temporary name and renamed when complete
+    const eckit::PathName tmp( file.asString() + ".tmp" );
+    {
+        std::ofstream out( tmp.localPath(), std::ios::out | std::ios::binary );
+        if ( not out.is_open() ) {
+            throw_CantOpenFile( tmp.asString(), Here() );
+        }
+        const std::uint64_t header_size = json.size();
+        const std::uint64_t data_begin  = aligned( sizeof( magic ) + 2 * sizeof( std::uint64_t ) + header_size );
+        const std::string padding( data_begin - sizeof( magic ) - 2 * sizeof( std::uint64_t ) - header_size, '\0' );
+
+        out.write( magic, sizeof( magic ) );
+        out.write( reinterpret_cast<const char*>( &version ), sizeof( version ) );
+        out.write( reinterpret_cast<const char*>( &header_size ), sizeof( header_size ) );
+        out.write( json.data(), json.size() );
+        out.write( padding.data(), padding.size() );
+        data.write( out );
+        if ( not out ) {
+            throw_Exception( "Could not write mesh checkpoint " + tmp.asString(), Here() );
+        }
+    }
+    eckit::PathName::rename( tmp, file );
+}
+
+Mesh Checkpoint::read( const eckit::PathName& file_path ) {
+    ATLAS_TRACE( "mesh::Checkpoint::read" );
+    const eckit::PathName file = path( file_path );
+    Log::debug() << "Reading mesh checkpoint " << file << std::endl;
+
+    MappedFile mapped( file );
+    const char* address = mapped.address();
+
+    const size_t preamble = sizeof( magic ) + 2 * sizeof( std::uint64_t );
+    if ( mapped.size() < preamble || std::memcmp( address, magic, sizeof( magic ) ) != 0 ) {
+        throw_Exception( file.asString() + " is not a mesh checkpoint", Here() );
+    }
+    std::uint64_t file_version;
+    std::uint64_t header_size;
+    std::memcpy( &file_version, address + sizeof( magic ), sizeof( file_version ) );
+    std::memcpy( &header_size, address + sizeof( magic ) + sizeof( file_version ), sizeof( header_size ) );
+    if ( file_version != version ) {
+        throw_Exception( "Unsupported version " + std::to_string( file_version ) + " of mesh checkpoint " +
+                             file.asString(),
+                         Here() );
+    }
+    std::istringstream json( std::string( address + preamble, header_size ) );
+    const util::Config header( json );
+    const char* data = address + aligned( preamble + header_size );
+
+    if ( static_cast<size_t>( header.getLong( "mpi_size" ) ) != mpi::size() ) {
+        throw_Exception( "Mesh checkpoint " + file.asString() + " was written with " +
+                             std::to_string( header.getLong( "mpi_size" ) ) + " tasks, but is read with " +
+                             std::to_string( mpi::size() ),
+                         Here() );
+    }
+    ATLAS_ASSERT( static_cast<size_t>( header.getLong( "sizeof_idx_t" ) ) == sizeof( idx_t ) );
+
+    Mesh mesh;
+    util::Config config;
+    if ( header.get( "projection", config ) ) {
+        mesh.setProjection( Projection( config ) );
+    }
+    if ( header.get( "grid", config ) ) {
+        mesh.setGrid( Grid( config ) );
+    }
+    header.get( "metadata", config );
+    mesh.metadata() = util::Metadata( config );
+
+    header.get( "nodes", config );
+    decode_nodes( data, config, mesh.nodes() );
+    header.get( "cells", config );
+    decode_elements( data, config, mesh.cells() );
+    header.get( "edges", config );
+    decode_elements( data, config, mesh.edges() );
+    return mesh;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+}  // namespace mesh
+}  // namespace atlas
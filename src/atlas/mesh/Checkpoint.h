@@ -0,0 +1,62 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#pragma once
+
+#include "atlas/library/config.h"
+#include "atlas/parallel/mpi/mpi.h"
+
+namespace eckit {
+class PathName;
+}
+
+namespace atlas {
+class Mesh;
+}
+
+namespace atlas {
+namespace mesh {
+
+//----------------------------------------------------------------------------------------------------------------------
+
+/// @brief Binary checkpoint of a fully built distributed Mesh, with one file per task
+///
+/// The checkpoint contains the nodes, cells and edges with all their fields and connectivities, including
+/// halos, parallel fields and fields of the dual mesh, as well as the metadata, grid and projection of the mesh.
+/// Every task writes and reads its own file independently, so that no communication is involved.
+///
+/// The file starts with a JSON header that describes the contents, followed by the raw values of the fields.
+/// Reading maps the file in memory and copies the values of every field with a single memcpy.
+/// The mesh must be read with the same number of tasks as it was written with.
+///
+/// Example:
+/// @code
+///     Mesh mesh = MeshGenerator( "structured" ).generate( grid );
+///     mesh::actions::build_halo( mesh, 1 );
+///     mesh::Checkpoint::write( mesh, "mesh.ckpt" );  // writes mesh.ckpt.p<rank> on every task
+///
+///     Mesh restart = mesh::Checkpoint::read( "mesh.ckpt" );
+/// @endcode
+class Checkpoint {
+public:
+    /// @brief Write the part of the mesh of this task
+    static void write( const Mesh&, const eckit::PathName& );
+
+    /// @brief Read the part of the mesh of this task
+    static Mesh read( const eckit::PathName& );
+
+    /// @brief Path of the file of given task
+    static eckit::PathName path( const eckit::PathName&, idx_t part = mpi::rank() );
+};
+
+//----------------------------------------------------------------------------------------------------------------------
+
+}  // namespace mesh
+}  // namespace atlas
@@ -17,8 +17,17 @@ namespace mesh {
 
 //------------------------------------------------------------------------------
 
-ElementType* ElementType::create( const std::string& ) {
-    ATLAS_NOTIMPLEMENTED;
+ElementType* ElementType::create( const std::string& name ) {
+    if ( name == "Triangle" ) {
+        return new temporary::Triangle();
+    }
+    if ( name == "Quadrilateral" ) {
+        return new temporary::Quadrilateral();
+    }
+    if ( name == "Line" ) {
+        return new temporary::Line();
+    }
+    throw_NotImplemented( "ElementType " + name, Here() );
 }
 
 ElementType::ElementType()  = default;
@@ -35,6 +35,7 @@ namespace atlas {
 namespace mesh {
 class Nodes;
 class HybridElements;
+class Checkpoint;
 typedef HybridElements Edges;
 typedef HybridElements Cells;
 }  // namespace mesh
@@ -131,6 +132,7 @@ private:  // methods
     }
 
     friend class meshgenerator::MeshGeneratorImpl;
+    friend class mesh::Checkpoint;
     void setProjection( const Projection& p ) { get()->setProjection( p ); }
     void setGrid( const Grid& p ) { get()->setGrid( p ); }
 };
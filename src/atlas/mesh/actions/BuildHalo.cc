@@ -8,12 +8,16 @@
  * nor does it submit to any jurisdiction.
  */
 
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <iomanip>
 #include <iostream>
+#include <iterator>
 #include <limits>
 #include <numeric>
 #include <stdexcept>
+#include <vector>
 
 #include "atlas/array.h"
 #include "atlas/array/IndexView.h"
@@ -58,15 +62,93 @@ namespace atlas {
 namespace mesh {
 namespace actions {
 
-struct Entity {
-    Entity( gidx_t gid, idx_t idx ) {
-        g = gid;
-        i = idx;
+namespace {
+
+// Number of regular samples each task contributes to select the bucket splitters of the distributed sort
+constexpr size_t sort_samples_per_task = 32;
+
+/// @brief Replace global indices by their rank among the distinct global indices of all tasks, counting from
+/// gid_start, so that equal indices on different tasks receive the same new index.
+///
+/// This is a distributed sample sort: distinct indices are bucketed over all tasks by splitters chosen from
+/// regular samples, so that work and memory per task remain proportional to the local number of indices.
+void renumber_global_index( std::vector<gidx_t>& glb_idx, gidx_t gid_start ) {
+    ATLAS_TRACE( "distributed sort" );
+    const auto& comm = mpi::comm();
+    const int nparts = static_cast<int>( comm.size() );
+
+    // 1) Sorted distinct local indices
+    std::vector<gidx_t> local_unique( glb_idx );
+    std::sort( local_unique.begin(), local_unique.end() );
+    local_unique.erase( std::unique( local_unique.begin(), local_unique.end() ), local_unique.end() );
+
+    // 2) Splitters from regular samples of all tasks; identical on every task
+    std::vector<gidx_t> samples;
+    const size_t nb_samples = std::min( local_unique.size(), sort_samples_per_task );
+    samples.reserve( nb_samples );
+    for ( size_t j = 0; j < nb_samples; ++j ) {
+        samples.emplace_back( local_unique[( j * local_unique.size() ) / nb_samples] );
+    }
+    mpi::Buffer<gidx_t, 1> recv_samples( nparts );
+    ATLAS_TRACE_MPI( ALLGATHER ) { comm.allGatherv( samples.begin(), samples.end(), recv_samples ); }
+    std::vector<gidx_t>& all_samples = recv_samples.buffer;
+    std::sort( all_samples.begin(), all_samples.end() );
+
+    std::vector<gidx_t> splitters( nparts - 1, 0 );
+    if ( !all_samples.empty() ) {
+        for ( int jpart = 1; jpart < nparts; ++jpart ) {
+            splitters[jpart - 1] = all_samples[( size_t( jpart ) * all_samples.size() ) / size_t( nparts )];
+        }
+    }
+
+    // 3) Send distinct indices to the task owning their bucket; buckets are contiguous in local_unique
+    std::vector<int> sendcounts( nparts, 0 );
+    for ( gidx_t g : local_unique ) {
+        ++sendcounts[std::upper_bound( splitters.begin(), splitters.end(), g ) - splitters.begin()];
+    }
+    std::vector<int> recvcounts( nparts );
+    ATLAS_TRACE_MPI( ALLTOALL ) { comm.allToAll( sendcounts, recvcounts ); }
+
+    std::vector<int> senddispls( nparts, 0 );
+    std::vector<int> recvdispls( nparts, 0 );
+    for ( int jpart = 1; jpart < nparts; ++jpart ) {  // start at 1
+        senddispls[jpart] = senddispls[jpart - 1] + sendcounts[jpart - 1];
+        recvdispls[jpart] = recvdispls[jpart - 1] + recvcounts[jpart - 1];
+    }
+    std::vector<gidx_t> recv_idx( recvdispls[nparts - 1] + recvcounts[nparts - 1] );
+    ATLAS_TRACE_MPI( ALLTOALL ) {
+        comm.allToAllv( local_unique.data(), sendcounts.data(), senddispls.data(), recv_idx.data(), recvcounts.data(),
+                        recvdispls.data() );
     }
-    gidx_t g;
-    idx_t i;
-    bool operator<( const Entity& other ) const { return ( g < other.g ); }
-};
+
+    // 4) Sort bucket; its first new index follows all distinct indices of lower buckets
+    std::vector<gidx_t> bucket( recv_idx );
+    ATLAS_TRACE_SCOPE( "sort bucket" ) {
+        std::sort( bucket.begin(), bucket.end() );
+        bucket.erase( std::unique( bucket.begin(), bucket.end() ), bucket.end() );
+    }
+    gidx_t bucket_size = static_cast<gidx_t>( bucket.size() );
+    std::vector<gidx_t> bucket_sizes( nparts );
+    ATLAS_TRACE_MPI( ALLGATHER ) { comm.allGather( bucket_size, bucket_sizes.begin(), bucket_sizes.end() ); }
+    const gidx_t bucket_start =
+        std::accumulate( bucket_sizes.begin(), bucket_sizes.begin() + comm.rank(), gid_start );
+
+    // 5) Return new indices to the requesting tasks
+    for ( auto& g : recv_idx ) {
+        g = bucket_start + ( std::lower_bound( bucket.begin(), bucket.end(), g ) - bucket.begin() );
+    }
+    std::vector<gidx_t> local_renumbered( local_unique.size() );
+    ATLAS_TRACE_MPI( ALLTOALL ) {
+        comm.allToAllv( recv_idx.data(), recvcounts.data(), recvdispls.data(), local_renumbered.data(),
+                        sendcounts.data(), senddispls.data() );
+    }
+
+    for ( auto& g : glb_idx ) {
+        g = local_renumbered[std::lower_bound( local_unique.begin(), local_unique.end(), g ) - local_unique.begin()];
+    }
+}
+
+}  // namespace
 
 void make_nodes_global_index_human_readable( const mesh::actions::BuildHalo& build_halo, mesh::Nodes& nodes,
                                              bool do_all ) {
@@ -76,10 +158,6 @@ void make_nodes_global_index_human_readable( const mesh::actions::BuildHalo& bui
     // uid,
     //     and could receive different gidx for different tasks
 
-    // unused // int mypart = mpi::rank();
-    int nparts  = mpi::size();
-    size_t root = 0;
-
     array::ArrayView<gidx_t, 1> nodes_glb_idx = array::make_view<gidx_t, 1>( nodes.global_index() );
     // nodes_glb_idx.dump( Log::info() );
     //  ATLAS_DEBUG( "min = " << nodes.global_index().metadata().getLong("min") );
@@ -129,50 +207,8 @@ void make_nodes_global_index_human_readable( const mesh::actions::BuildHalo& bui
     //    }
     //  }
 
-    // 1) Gather all global indices, together with location
-
-    std::vector<int> recvcounts( mpi::size() );
-    std::vector<int> recvdispls( mpi::size() );
-
-    ATLAS_TRACE_MPI( GATHER ) { mpi::comm().gather( nb_nodes, recvcounts, root ); }
-    idx_t glb_nb_nodes = std::accumulate( recvcounts.begin(), recvcounts.end(), 0 );
-
-    recvdispls[0] = 0;
-    for ( int jpart = 1; jpart < nparts; ++jpart ) {  // start at 1
-        recvdispls[jpart] = recvcounts[jpart - 1] + recvdispls[jpart - 1];
-    }
-
-    std::vector<gidx_t> glb_idx_gathered( glb_nb_nodes );
-    ATLAS_TRACE_MPI( GATHER ) {
-        mpi::comm().gatherv( glb_idx.data(), glb_idx.size(), glb_idx_gathered.data(), recvcounts.data(),
-                             recvdispls.data(), root );
-    }
-
-    // 2) Sort all global indices, and renumber from 1 to glb_nb_edges
-    std::vector<Entity> node_sort;
-    node_sort.reserve( glb_nb_nodes );
-    const idx_t nb_glb_idx_gathered = static_cast<idx_t>( glb_idx_gathered.size() );
-    for ( idx_t jnode = 0; jnode < nb_glb_idx_gathered; ++jnode ) {
-        node_sort.emplace_back( glb_idx_gathered[jnode], jnode );
-    }
-
-    ATLAS_TRACE_SCOPE( "sort on rank 0" ) { std::sort( node_sort.begin(), node_sort.end() ); }
-
-    gidx_t gid               = glb_idx_max + 1;
-    const idx_t nb_node_sort = static_cast<idx_t>( node_sort.size() );
-    for ( idx_t jnode = 0; jnode < nb_node_sort; ++jnode ) {
-        if ( jnode > 0 && node_sort[jnode].g != node_sort[jnode - 1].g ) {
-            ++gid;
-        }
-        int inode               = node_sort[jnode].i;
-        glb_idx_gathered[inode] = gid;
-    }
-
-    // 3) Scatter renumbered back
-    ATLAS_TRACE_MPI( SCATTER ) {
-        mpi::comm().scatterv( glb_idx_gathered.data(), recvcounts.data(), recvdispls.data(), glb_idx.data(),
-                              static_cast<int>( glb_idx.size() ), root );
-    }
+    // Sort all global indices in parallel, and renumber from glb_idx_max+1
+    renumber_global_index( glb_idx, glb_idx_max + 1 );
 
     for ( int jnode = 0; jnode < nb_nodes; ++jnode ) {
         nodes_glb_idx( points_to_edit[jnode] ) = glb_idx[jnode];
@@ -189,9 +225,6 @@ void make_cells_global_index_human_readable( const mesh::actions::BuildHalo& bui
                                              bool do_all ) {
     ATLAS_TRACE();
 
-    int nparts = static_cast<idx_t>( mpi::size() );
-    idx_t root = 0;
-
     array::ArrayView<gidx_t, 1> cells_glb_idx = array::make_view<gidx_t, 1>( cells.global_index() );
     //  ATLAS_DEBUG( "min = " << cells.global_index().metadata().getLong("min") );
     //  ATLAS_DEBUG( "max = " << cells.global_index().metadata().getLong("max") );
@@ -230,48 +263,8 @@ void make_cells_global_index_human_readable( const mesh::actions::BuildHalo& bui
         glb_idx[i] = cells_glb_idx( cells_to_edit[i] );
     }
 
-    // 1) Gather all global indices, together with location
-
-    std::vector<int> recvcounts( mpi::size() );
-    std::vector<int> recvdispls( mpi::size() );
-
-    ATLAS_TRACE_MPI( GATHER ) { mpi::comm().gather( nb_cells, recvcounts, root ); }
-    idx_t glb_nb_cells = std::accumulate( recvcounts.begin(), recvcounts.end(), 0 );
-
-    recvdispls[0] = 0;
-    for ( int jpart = 1; jpart < nparts; ++jpart ) {  // start at 1
-        recvdispls[jpart] = recvcounts[jpart - 1] + recvdispls[jpart - 1];
-    }
-
-    std::vector<gidx_t> glb_idx_gathered( glb_nb_cells );
-    ATLAS_TRACE_MPI( GATHER ) {
-        mpi::comm().gatherv( glb_idx.data(), glb_idx.size(), glb_idx_gathered.data(), recvcounts.data(),
-                             recvdispls.data(), root );
-    }
-
-    // 2) Sort all global indices, and renumber from 1 to glb_nb_edges
-    std::vector<Entity> cell_sort;
-    cell_sort.reserve( glb_nb_cells );
-    for ( idx_t jcell = 0; jcell < glb_nb_cells; ++jcell ) {
-        cell_sort.emplace_back( glb_idx_gathered[jcell], jcell );
-    }
-
-    ATLAS_TRACE_SCOPE( "sort on rank 0" ) { std::sort( cell_sort.begin(), cell_sort.end() ); }
-
-    gidx_t gid = glb_idx_max + 1;
-    for ( idx_t jcell = 0; jcell < glb_nb_cells; ++jcell ) {
-        if ( jcell > 0 && cell_sort[jcell].g != cell_sort[jcell - 1].g ) {
-            ++gid;
-        }
-        idx_t icell             = cell_sort[jcell].i;
-        glb_idx_gathered[icell] = gid;
-    }
-
-    // 3) Scatter renumbered back
-    ATLAS_TRACE_MPI( SCATTER ) {
-        mpi::comm().scatterv( glb_idx_gathered.data(), recvcounts.data(), recvdispls.data(), glb_idx.data(),
-                              static_cast<int>( glb_idx.size() ), root );
-    }
+    // Sort all global indices in parallel, and renumber from glb_idx_max+1
+    renumber_global_index( glb_idx, glb_idx_max + 1 );
 
     for ( int jcell = 0; jcell < nb_cells; ++jcell ) {
         cells_glb_idx( cells_to_edit[jcell] ) = glb_idx[jcell];
@@ -428,7 +421,95 @@ private:
     std::vector<std::string> notes;
 };
 
-using Uid2Node = std::map<uid_t, idx_t>;
+/// @brief Flat open-addressing hash table (linear probing) mapping a uid to a non-negative local index
+///
+/// Keys and values are stored in two contiguous arrays, so that lookups for the many thousands of halo nodes
+/// do not chase tree nodes as std::map or std::set would.
+class Uid2Node {
+public:
+    static constexpr idx_t not_found = -1;
+
+    Uid2Node() { rehash( 16 ); }
+
+    idx_t size() const { return size_; }
+
+    void clear() {
+        std::fill( values_.begin(), values_.end(), not_found );
+        size_ = 0;
+    }
+
+    void reserve( idx_t n ) {
+        size_t capacity = values_.size();
+        while ( capacity < 2 * size_t( n ) ) {
+            capacity *= 2;
+        }
+        if ( capacity != values_.size() ) {
+            rehash( capacity );
+        }
+    }
+
+    /// Insert (uid,idx) and return true, or return false if uid is already present
+    bool insert( uid_t uid, idx_t idx ) {
+        ATLAS_ASSERT( idx != not_found );
+        if ( 2 * size_t( size_ + 1 ) > values_.size() ) {
+            rehash( 2 * values_.size() );
+        }
+        size_t slot = lookup( uid );
+        if ( values_[slot] != not_found ) {
+            return false;
+        }
+        keys_[slot]   = uid;
+        values_[slot] = idx;
+        ++size_;
+        return true;
+    }
+
+    /// Return index associated with uid, or Uid2Node::not_found
+    idx_t find( uid_t uid ) const { return values_[lookup( uid )]; }
+
+private:
+    static size_t hash( uid_t uid ) {
+        // Finalizer of MurmurHash3, as uids computed from coordinates are not uniformly distributed in lower bits
+        uint64_t h = static_cast<uint64_t>( uid );
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        h *= 0xc4ceb9fe1a85ec53ULL;
+        h ^= h >> 33;
+        return static_cast<size_t>( h );
+    }
+
+    size_t lookup( uid_t uid ) const {
+        const size_t mask = values_.size() - 1;
+        size_t slot       = hash( uid ) & mask;
+        while ( values_[slot] != not_found && keys_[slot] != uid ) {
+            slot = ( slot + 1 ) & mask;
+        }
+        return slot;
+    }
+
+    void rehash( size_t capacity ) {
+        std::vector<uid_t> keys( capacity );
+        std::vector<idx_t> values( capacity, not_found );
+        keys.swap( keys_ );
+        values.swap( values_ );
+        size_ = 0;
+        for ( size_t j = 0; j < values.size(); ++j ) {
+            if ( values[j] != not_found ) {
+                size_t slot   = lookup( keys[j] );
+                keys_[slot]   = keys[j];
+                values_[slot] = values[j];
+                ++size_;
+            }
+        }
+    }
+
+    std::vector<uid_t> keys_;
+    std::vector<idx_t> values_;
+    idx_t size_{0};
+};
+constexpr idx_t Uid2Node::not_found;
+
 void build_lookup_uid2node( Mesh& mesh, Uid2Node& uid2node ) {
     ATLAS_TRACE();
     Notification notes;
@@ -440,11 +521,12 @@ void build_lookup_uid2node( Mesh& mesh, Uid2Node& uid2node ) {
     UniqueLonLat compute_uid( mesh );
 
     uid2node.clear();
+    uid2node.reserve( nb_nodes );
     for ( idx_t jnode = 0; jnode < nb_nodes; ++jnode ) {
         uid_t uid     = compute_uid( jnode );
-        bool inserted = uid2node.insert( std::make_pair( uid, jnode ) ).second;
+        bool inserted = uid2node.insert( uid, jnode );
         if ( not inserted ) {
-            int other = uid2node[uid];
+            idx_t other = uid2node.find( uid );
             std::stringstream msg;
             msg << std::setprecision( 10 ) << std::fixed << "Node uid: " << uid << "   " << glb_idx( jnode ) << " xy("
                 << xy( jnode, XX ) << "," << xy( jnode, YY ) << ")";
@@ -468,7 +550,7 @@ void build_lookup_uid2node( Mesh& mesh, Uid2Node& uid2node ) {
 
 void accumulate_elements( const Mesh& mesh, const mpi::BufferView<uid_t>& request_node_uid, const Uid2Node& uid2node,
                           const Node2Elem& node2elem, std::vector<idx_t>& found_elements,
-                          std::set<uid_t>& new_nodes_uid ) {
+                          std::vector<uid_t>& new_nodes_uid ) {
     // ATLAS_TRACE();
     const mesh::HybridElements::Connectivity& elem_nodes = mesh.cells().node_connectivity();
     const auto elem_part                                 = array::make_view<int, 1>( mesh.cells().partition() );
@@ -477,44 +559,47 @@ void accumulate_elements( const Mesh& mesh, const mpi::BufferView<uid_t>& reques
     const idx_t nb_request_nodes = static_cast<idx_t>( request_node_uid.size() );
     const int mpi_rank           = static_cast<int>( mpi::rank() );
 
-    std::set<idx_t> found_elements_set;
-
+    found_elements.clear();
     for ( idx_t jnode = 0; jnode < nb_request_nodes; ++jnode ) {
-        uid_t uid = request_node_uid( jnode );
-
-        idx_t inode = -1;
         // search and get node index for uid
-        Uid2Node::const_iterator found = uid2node.find( uid );
-        if ( found != uid2node.end() ) {
-            inode = found->second;
-        }
-        if ( inode != -1 && inode < nb_nodes ) {
+        idx_t inode = uid2node.find( request_node_uid( jnode ) );
+        if ( inode != Uid2Node::not_found && inode < nb_nodes ) {
             for ( const idx_t e : node2elem[inode] ) {
                 if ( elem_part( e ) == mpi_rank ) {
-                    found_elements_set.insert( e );
+                    found_elements.push_back( e );
                 }
             }
         }
     }
 
-    // found_bdry_elements_set now contains elements for the nodes
-    found_elements = std::vector<idx_t>( found_elements_set.begin(), found_elements_set.end() );
+    // Sorted unique elements for the nodes
+    std::sort( found_elements.begin(), found_elements.end() );
+    found_elements.erase( std::unique( found_elements.begin(), found_elements.end() ), found_elements.end() );
 
     UniqueLonLat compute_uid( mesh );
 
     // Collect all nodes
-    new_nodes_uid.clear();
+    std::vector<uid_t> elem_nodes_uid;
     for ( const idx_t e : found_elements ) {
         idx_t nb_elem_nodes = elem_nodes.cols( e );
         for ( idx_t n = 0; n < nb_elem_nodes; ++n ) {
-            new_nodes_uid.insert( compute_uid( elem_nodes( e, n ) ) );
+            elem_nodes_uid.push_back( compute_uid( elem_nodes( e, n ) ) );
         }
     }
+    std::sort( elem_nodes_uid.begin(), elem_nodes_uid.end() );
+    elem_nodes_uid.erase( std::unique( elem_nodes_uid.begin(), elem_nodes_uid.end() ), elem_nodes_uid.end() );
 
     // Remove nodes we already have in the request-buffer
+    std::vector<uid_t> request_uid( nb_request_nodes );
     for ( idx_t jnode = 0; jnode < nb_request_nodes; ++jnode ) {
-        new_nodes_uid.erase( request_node_uid( jnode ) );
+        request_uid[jnode] = request_node_uid( jnode );
     }
+    std::sort( request_uid.begin(), request_uid.end() );
+
+    new_nodes_uid.clear();
+    new_nodes_uid.reserve( elem_nodes_uid.size() );
+    std::set_difference( elem_nodes_uid.begin(), elem_nodes_uid.end(), request_uid.begin(), request_uid.end(),
+                         std::back_inserter( new_nodes_uid ) );
 }
 
 class BuildHaloHelper {
@@ -692,14 +777,13 @@ public:
         buf.node_xy[p].resize( 2 * nb_nodes );
 
         idx_t jnode = 0;
-        typename NodeContainer::iterator it;
+        typename NodeContainer::const_iterator it;
         for ( it = nodes_uid.begin(); it != nodes_uid.end(); ++it, ++jnode ) {
             uid_t uid = *it;
 
-            Uid2Node::iterator found = uid2node.find( uid );
-            if ( found != uid2node.end() )  // Point exists inside domain
+            idx_t node = uid2node.find( uid );
+            if ( node != Uid2Node::not_found )  // Point exists inside domain
             {
-                idx_t node                     = found->second;
                 buf.node_glb_idx[p][jnode]     = glb_idx( node );
                 buf.node_part[p][jnode]        = part( node );
                 buf.node_ridx[p][jnode]        = ridx( node );
@@ -758,14 +842,13 @@ public:
         buf.node_xy[p].resize( 2 * nb_nodes );
 
         int jnode = 0;
-        typename NodeContainer::iterator it;
+        typename NodeContainer::const_iterator it;
         for ( it = nodes_uid.begin(); it != nodes_uid.end(); ++it, ++jnode ) {
             uid_t uid = *it;
 
-            Uid2Node::iterator found = uid2node.find( uid );
-            if ( found != uid2node.end() )  // Point exists inside domain
+            idx_t node = uid2node.find( uid );
+            if ( node != Uid2Node::not_found )  // Point exists inside domain
             {
-                int node                       = found->second;
                 buf.node_part[p][jnode]        = part( node );
                 buf.node_ridx[p][jnode]        = ridx( node );
                 buf.node_xy[p][jnode * 2 + XX] = xy( node, XX );
@@ -830,7 +913,7 @@ public:
         // Nodes might be duplicated from different Tasks. We need to identify
         // unique entries
         std::vector<uid_t> node_uid( nb_nodes );
-        std::set<uid_t> new_node_uid;
+        Uid2Node new_node_uid;
         {
             ATLAS_TRACE( "compute node_uid" );
             for ( int jnode = 0; jnode < nb_nodes; ++jnode ) {
@@ -842,7 +925,7 @@ public:
             std::vector<uid_t>::iterator it = std::lower_bound( node_uid.begin(), node_uid.end(), uid );
             bool not_found                  = ( it == node_uid.end() || uid < *it );
             if ( not_found ) {
-                bool inserted = new_node_uid.insert( uid ).second;
+                bool inserted = new_node_uid.insert( uid, 0 );
                 return not inserted;
             }
             else {
@@ -907,10 +990,9 @@ public:
 
                 // make sure new node was not already there
                 {
-                    uid_t uid                = compute_uid( loc_idx );
-                    Uid2Node::iterator found = uid2node.find( uid );
-                    if ( found != uid2node.end() ) {
-                        int other = found->second;
+                    uid_t uid   = compute_uid( loc_idx );
+                    idx_t other = uid2node.find( uid );
+                    if ( other != Uid2Node::not_found ) {
                         std::stringstream msg;
                         msg << "New node with uid " << uid << ":\n"
                             << glb_idx( loc_idx ) << "(" << xy( loc_idx, XX ) << "," << xy( loc_idx, YY ) << ")\n";
@@ -918,7 +1000,7 @@ public:
                             << "," << xy( other, YY ) << ")\n";
                         throw_Exception( msg.str(), Here() );
                     }
-                    uid2node[uid] = nb_nodes + new_node;
+                    uid2node.insert( uid, nb_nodes + new_node );
                 }
                 ++new_node;
             }
@@ -935,7 +1017,7 @@ public:
         int nb_elems = mesh.cells().size();
         //    std::set<uid_t> elem_uid;
         std::vector<uid_t> elem_uid( 2 * nb_elems );
-        std::set<uid_t> new_elem_uid;
+        Uid2Node new_elem_uid;
         {
             ATLAS_TRACE( "compute elem_uid" );
             for ( int jelem = 0; jelem < nb_elems; ++jelem ) {
@@ -948,7 +1030,7 @@ public:
             std::vector<uid_t>::iterator it = std::lower_bound( elem_uid.begin(), elem_uid.end(), uid );
             bool not_found                  = ( it == elem_uid.end() || uid < *it );
             if ( not_found ) {
-                bool inserted = new_elem_uid.insert( uid ).second;
+                bool inserted = new_elem_uid.insert( uid, 0 );
                 return not inserted;
             }
             else {
@@ -1018,7 +1100,8 @@ public:
                     elem_type_flags( loc_idx )   = buf.elem_flags[jpart][jelem];
                     for ( idx_t n = 0; n < node_connectivity.cols(); ++n ) {
                         node_connectivity.set(
-                            loc_idx, n, uid2node[buf.elem_nodes_id[jpart][buf.elem_nodes_displs[jpart][jelem] + n]] );
+                            loc_idx, n,
+                            uid2node.find( buf.elem_nodes_id[jpart][buf.elem_nodes_displs[jpart][jelem] + n] ) );
                     }
 
                     if ( Topology::check( elem_type_flags( loc_idx ), Topology::PERIODIC ) ) {
@@ -1164,7 +1247,7 @@ void increase_halo_interior( BuildHaloHelper& helper ) {
         mpi::BufferView<uid_t> recv_bdry_nodes_uid = recv_bdry_nodes_uid_from_parts[jpart];
 
         std::vector<idx_t> found_bdry_elems;
-        std::set<uid_t> found_bdry_nodes_uid;
+        std::vector<uid_t> found_bdry_nodes_uid;
 
         accumulate_elements( helper.mesh, recv_bdry_nodes_uid, helper.uid2node, helper.node_to_elem, found_bdry_elems,
                              found_bdry_nodes_uid );
@@ -1276,7 +1359,7 @@ void increase_halo_periodic( BuildHaloHelper& helper, const PeriodicPoints& peri
         atlas::mpi::BufferView<uid_t> recv_bdry_nodes_uid = recv_bdry_nodes_uid_from_parts[jpart];
 
         std::vector<idx_t> found_bdry_elems;
-        std::set<uid_t> found_bdry_nodes_uid;
+        std::vector<uid_t> found_bdry_nodes_uid;
 
         accumulate_elements( helper.mesh, recv_bdry_nodes_uid, helper.uid2node, helper.node_to_elem, found_bdry_elems,
                              found_bdry_nodes_uid );
@@ -13,6 +13,8 @@
 #include <limits>
 #include <memory>
 #include <numeric>
+#include <sstream>
+#include <string>
 #include <vector>
 
 #include "eckit/types/FloatCompare.h"
@@ -34,6 +36,7 @@
 #include "atlas/meshgenerator/detail/MeshGeneratorFactory.h"
 #include "atlas/meshgenerator/detail/StructuredMeshGenerator.h"
 #include "atlas/parallel/mpi/mpi.h"
+#include "atlas/parallel/omp/omp.h"
 #include "atlas/runtime/Log.h"
 #include "atlas/runtime/Trace.h"
 #include "atlas/util/CoordinateEnums.h"
@@ -50,6 +53,20 @@ namespace meshgenerator {
 namespace {
 static double to_rad = M_PI / 180.;
 static double to_deg = 180. * M_1_PI;
+
+// Range of columns touched by the elements of one latitude band on its northern (N) and southern (S) latitude.
+// A begin of -1 means no column was touched yet.
+struct BandRange {
+    idx_t beginN{-1};
+    idx_t endN{-1};
+    idx_t beginS{-1};
+    idx_t endS{-1};
+    std::string error;  // no exceptions nor logging within the parallel region; set instead and thrown afterwards
+};
+
+void extend_begin( idx_t& begin, idx_t jlon ) {
+    begin = ( begin == -1 ) ? jlon : std::min( begin, jlon );
+}
 }  // namespace
 
 struct Region {
@@ -62,6 +79,7 @@ struct Region {
     std::vector<idx_t> lat_begin;
     std::vector<idx_t> lat_end;
     std::vector<idx_t> nb_lat_elems;
+    std::vector<idx_t> nb_lat_quads;
 };
 
 StructuredMeshGenerator::StructuredMeshGenerator( const eckit::Parametrisation& p ) {
@@ -278,31 +296,31 @@ void StructuredMeshGenerator::generate_region( const StructuredGrid& rg, const g
     /*
 Find min and max latitudes used by this part.
 */
+    // Partitions are looked up per latitude, which is much cheaper than per point for interval distributions
+    std::vector<int> lat_part( rg.nxmax() );
+    auto latitude_has_mypart = [&]( idx_t jlat, gidx_t begin ) {
+        distribution.partition( begin, begin + rg.nx( jlat ), lat_part );
+        return std::find( lat_part.begin(), lat_part.begin() + rg.nx( jlat ), mypart ) !=
+               lat_part.begin() + rg.nx( jlat );
+    };
+
     n               = 0;
     idx_t lat_north = -1;
-    for ( idx_t jlat = 0; jlat < rg.ny(); ++jlat ) {
-        for ( idx_t jlon = 0; jlon < rg.nx( jlat ); ++jlon ) {
-            if ( distribution.partition( n ) == mypart ) {
-                lat_north = jlat;
-                goto end_north;
-            }
-            ++n;
+    for ( idx_t jlat = 0; jlat < rg.ny() && lat_north < 0; ++jlat ) {
+        if ( latitude_has_mypart( jlat, n ) ) {
+            lat_north = jlat;
         }
+        n += rg.nx( jlat );
     }
-end_north:
 
-    n               = rg.size() - 1;
+    n               = rg.size();
     idx_t lat_south = -1;
-    for ( idx_t jlat = rg.ny() - 1; jlat >= 0; --jlat ) {
-        for ( idx_t jlon = rg.nx( jlat ) - 1; jlon >= 0; --jlon ) {
-            if ( distribution.partition( n ) == mypart ) {
-                lat_south = jlat;
-                goto end_south;
-            }
-            --n;
+    for ( idx_t jlat = rg.ny() - 1; jlat >= 0 && lat_south < 0; --jlat ) {
+        n -= rg.nx( jlat );
+        if ( latitude_has_mypart( jlat, n ) ) {
+            lat_south = jlat;
         }
     }
-end_south:
 
     std::vector<idx_t> offset( rg.ny(), 0 );
 
@@ -331,15 +349,18 @@ We need to connect to next region
 
     region.elems.reset( array::Array::create<int>( shape ) );
 
-    int nelems     = 0;
     region.nquads  = 0;
     region.ntriags = 0;
+    region.nb_lat_quads.resize( rg.ny(), 0 );
 
     array::ArrayView<int, 3> elemview = array::make_view<int, 3>( *region.elems );
     elemview.assign( -1 );
 
-    for ( idx_t jlat = lat_north; jlat < lat_south; ++jlat ) {
-        //    std::stringstream filename; filename << "/tmp/debug/"<<jlat;
+    // Latitude bands are triangulated independently by different threads. The column ranges touched by each band
+    // are merged in latitude order afterwards, which gives the same region as a serial sweep.
+    std::vector<BandRange> band_range( std::max<idx_t>( 0, lat_south - lat_north ) );
+
+    atlas_omp_parallel_for( idx_t jlat = lat_north; jlat < lat_south; ++jlat ) {
 
         idx_t ilat, latN, latS;
         idx_t ipN1, ipN2, ipS1, ipS2;
@@ -348,7 +369,9 @@ We need to connect to next region
         bool try_make_triangle_up, try_make_triangle_down, try_make_quad;
         bool add_triag, add_quad;
 
-        ilat = jlat - region.north;
+        ilat = jlat - lat_north;
+
+        BandRange& range = band_range[ilat];
 
         auto lat_elems_view = elemview.slice( ilat, Range::all(), Range::all() );
 
@@ -376,8 +399,13 @@ We need to connect to next region
         ipN2 = std::min( ipN1 + 1, endN );
         ipS2 = std::min( ipS1 + 1, endS );
 
+        std::vector<int> partN( rg.nx( latN ) );
+        std::vector<int> partS( rg.nx( latS ) );
+        distribution.partition( offset[latN], offset[latN] + rg.nx( latN ), partN );
+        distribution.partition( offset[latS], offset[latS] + rg.nx( latS ), partS );
+
         idx_t jelem = 0;
-        int pE      = distribution.partition( offset.at( latN ) );
+        int pE      = partN[0];
 
 #if DEBUG_OUTPUT
         Log::info() << "=================\n";
@@ -398,29 +426,29 @@ We need to connect to next region
 
             int pN1, pS1, pN2, pS2;
             if ( ipN1 != rg.nx( latN ) ) {
-                pN1 = distribution.partition( offset.at( latN ) + ipN1 );
+                pN1 = partN[ipN1];
             }
             else {
-                pN1 = distribution.partition( offset.at( latN ) );
+                pN1 = partN[0];
             }
             if ( ipS1 != rg.nx( latS ) ) {
-                pS1 = distribution.partition( offset.at( latS ) + ipS1 );
+                pS1 = partS[ipS1];
             }
             else {
-                pS1 = distribution.partition( offset.at( latS ) );
+                pS1 = partS[0];
             }
 
             if ( ipN2 == rg.nx( latN ) ) {
-                pN2 = distribution.partition( offset.at( latN ) );
+                pN2 = partN[0];
             }
             else {
-                pN2 = distribution.partition( offset.at( latN ) + ipN2 );
+                pN2 = partN[ipN2];
             }
             if ( ipS2 == rg.nx( latS ) ) {
-                pS2 = distribution.partition( offset.at( latS ) );
+                pS2 = partS[0];
             }
             else {
-                pS2 = distribution.partition( offset.at( latS ) + ipS2 );
+                pS2 = partS[ipS2];
             }
 
             // Log::info()  << ipN1 << "("<<pN1<<") " << ipN2 <<"("<<pN2<<")" <<  std::endl;
@@ -493,7 +521,8 @@ We need to connect to next region
                             }
                         }
                         else {
-                            throw_Exception( "Should not be here", Here() );
+                            range.error = "Should not be here";
+                            break;
                         }
                     }
                 }
@@ -531,12 +560,15 @@ We need to connect to next region
                         try_make_triangle_down = true;
                     }
                     else {
-                        ATLAS_DEBUG_VAR( dN1S2 );
-                        ATLAS_DEBUG_VAR( dS1N2 );
-                        ATLAS_DEBUG_VAR( jlat );
-                        Log::info() << ipN1 << "(" << xN1 << ")  " << ipN2 << "(" << xN2 << ")  " << std::endl;
-                        Log::info() << ipS1 << "(" << xS1 << ")  " << ipS2 << "(" << xS2 << ")  " << std::endl;
-                        throw_Exception( "Should not try to make a quadrilateral!", Here() );
+                        std::ostringstream error;
+                        error << "Should not try to make a quadrilateral!\n"
+                              << "dN1S2 = " << dN1S2 << "\n"
+                              << "dS1N2 = " << dS1N2 << "\n"
+                              << "jlat = " << jlat << "\n"
+                              << ipN1 << "(" << xN1 << ")  " << ipN2 << "(" << xN2 << ")  \n"
+                              << ipS1 << "(" << xS1 << ")  " << ipS2 << "(" << xS2 << ")  ";
+                        range.error = error.str();
+                        break;
                     }
                 }
             }
@@ -592,20 +624,13 @@ We need to connect to next region
                 }
                 add_quad = ( pE == mypart );
                 if ( add_quad ) {
-                    ++region.nquads;
+                    ++region.nb_lat_quads[jlat];
                     ++jelem;
-                    ++nelems;
 
-                    if ( region.lat_begin.at( latN ) == -1 ) {
-                        region.lat_begin.at( latN ) = ipN1;
-                    }
-                    if ( region.lat_begin.at( latS ) == -1 ) {
-                        region.lat_begin.at( latS ) = ipS1;
-                    }
-                    region.lat_begin.at( latN ) = std::min<int>( region.lat_begin.at( latN ), ipN1 );
-                    region.lat_begin.at( latS ) = std::min<int>( region.lat_begin.at( latS ), ipS1 );
-                    region.lat_end.at( latN )   = std::max<int>( region.lat_end.at( latN ), ipN2 );
-                    region.lat_end.at( latS )   = std::max<int>( region.lat_end.at( latS ), ipS2 );
+                    extend_begin( range.beginN, ipN1 );
+                    extend_begin( range.beginS, ipS1 );
+                    range.endN = std::max( range.endN, ipN2 );
+                    range.endS = std::max( range.endS, ipS2 );
                 }
                 else {
 #if DEBUG_OUTPUT
@@ -634,20 +659,12 @@ We need to connect to next region
                 add_triag = ( mypart == pE );
 
                 if ( add_triag ) {
-                    ++region.ntriags;
                     ++jelem;
-                    ++nelems;
 
-                    if ( region.lat_begin.at( latN ) == -1 ) {
-                        region.lat_begin.at( latN ) = ipN1;
-                    }
-                    if ( region.lat_begin.at( latS ) == -1 ) {
-                        region.lat_begin.at( latS ) = ipS1;
-                    }
-                    region.lat_begin.at( latN ) = std::min<int>( region.lat_begin.at( latN ), ipN1 );
-                    region.lat_begin.at( latS ) = std::min<int>( region.lat_begin.at( latS ), ipS1 );
-                    region.lat_end.at( latN )   = std::max<int>( region.lat_end.at( latN ), ipN2 );
-                    region.lat_end.at( latS )   = std::max<int>( region.lat_end.at( latS ), ipS1 );
+                    extend_begin( range.beginN, ipN1 );
+                    extend_begin( range.beginS, ipS1 );
+                    range.endN = std::max( range.endN, ipN2 );
+                    range.endS = std::max( range.endS, ipS1 );
                 }
                 else {
 #if DEBUG_OUTPUT
@@ -688,20 +705,12 @@ We need to connect to next region
                 add_triag = ( mypart == pE );
 
                 if ( add_triag ) {
-                    ++region.ntriags;
                     ++jelem;
-                    ++nelems;
 
-                    if ( region.lat_begin.at( latN ) == -1 ) {
-                        region.lat_begin.at( latN ) = ipN1;
-                    }
-                    if ( region.lat_begin.at( latS ) == -1 ) {
-                        region.lat_begin.at( latS ) = ipS1;
-                    }
-                    region.lat_begin.at( latN ) = std::min( region.lat_begin.at( latN ), ipN1 );
-                    region.lat_begin.at( latS ) = std::min( region.lat_begin.at( latS ), ipS1 );
-                    region.lat_end.at( latN )   = std::max( region.lat_end.at( latN ), ipN1 );
-                    region.lat_end.at( latS )   = std::max( region.lat_end.at( latS ), ipS2 );
+                    extend_begin( range.beginN, ipN1 );
+                    extend_begin( range.beginS, ipS1 );
+                    range.endN = std::max( range.endN, ipN1 );
+                    range.endS = std::max( range.endS, ipS2 );
                 }
                 else {
 #if DEBUG_OUTPUT
@@ -712,15 +721,41 @@ We need to connect to next region
                 // and ipN1=ipN1;
             }
             else {
-                throw_Exception( "Could not detect which element to create", Here() );
+                range.error = "Could not detect which element to create";
+                break;
             }
             ipN2 = std::min( endN, ipN1 + 1 );
             ipS2 = std::min( endS, ipS1 + 1 );
         }
-        region.nb_lat_elems.at( jlat ) = jelem;
+        region.nb_lat_elems[jlat] = jelem;
 #if DEBUG_OUTPUT
         ATLAS_DEBUG_VAR( region.nb_lat_elems.at( jlat ) );
 #endif
+    }  // for jlat
+
+    for ( const BandRange& range : band_range ) {
+        if ( not range.error.empty() ) {
+            throw_Exception( range.error, Here() );
+        }
+    }
+
+    for ( idx_t jlat = lat_north; jlat < lat_south; ++jlat ) {
+        const BandRange& range = band_range[jlat - lat_north];
+
+        idx_t latN = jlat;
+        idx_t latS = jlat + 1;
+        double yN  = rg.y( latN );
+        double yS  = rg.y( latS );
+
+        region.nquads += region.nb_lat_quads.at( jlat );
+        region.ntriags += region.nb_lat_elems.at( jlat ) - region.nb_lat_quads.at( jlat );
+        if ( region.nb_lat_elems.at( jlat ) > 0 ) {
+            extend_begin( region.lat_begin.at( latN ), range.beginN );
+            extend_begin( region.lat_begin.at( latS ), range.beginS );
+            region.lat_end.at( latN ) = std::max( region.lat_end.at( latN ), range.endN );
+            region.lat_end.at( latS ) = std::max( region.lat_end.at( latS ), range.endS );
+        }
+
         if ( region.nb_lat_elems.at( jlat ) == 0 && latN == region.north ) {
             ++region.north;
         }
@@ -742,24 +777,36 @@ We need to connect to next region
             region.lat_end.at( latN ) = std::max( region.lat_end.at( latN ), region.lat_begin.at( latN ) );
             region.lat_end.at( latS ) = std::max( region.lat_end.at( latS ), region.lat_begin.at( latS ) );
         }
-    }  // for jlat
+    }
+
+    // Element rows are stored relative to lat_north; move them if empty bands were removed in the north
+    if ( region.north > lat_north ) {
+        for ( idx_t jlat = region.north; jlat < region.south; ++jlat ) {
+            for ( idx_t jelem = 0; jelem < region.nb_lat_elems[jlat]; ++jelem ) {
+                for ( idx_t jnode = 0; jnode < 4; ++jnode ) {
+                    elemview( jlat - region.north, jelem, jnode ) = elemview( jlat - lat_north, jelem, jnode );
+                }
+            }
+        }
+    }
 
     //  Log::info()  << "nb_triags = " << region.ntriags << std::endl;
     //  Log::info()  << "nb_quads = " << region.nquads << std::endl;
     //  Log::info()  << "nb_elems = " << nelems << std::endl;
 
     int nb_region_nodes = 0;
+    atlas_omp_pragma( omp parallel for schedule(guided) reduction(+:nb_region_nodes) )
     for ( int jlat = region.north; jlat <= region.south; ++jlat ) {
-        n                           = offset.at( jlat );
-        region.lat_begin.at( jlat ) = std::max<idx_t>( 0, region.lat_begin.at( jlat ) );
+        std::vector<int> part( rg.nx( jlat ) );
+        distribution.partition( offset[jlat], offset[jlat] + rg.nx( jlat ), part );
+        region.lat_begin[jlat] = std::max<idx_t>( 0, region.lat_begin[jlat] );
         for ( idx_t jlon = 0; jlon < rg.nx( jlat ); ++jlon ) {
-            if ( distribution.partition( n ) == mypart ) {
-                region.lat_begin.at( jlat ) = std::min( region.lat_begin.at( jlat ), jlon );
-                region.lat_end.at( jlat )   = std::max( region.lat_end.at( jlat ), jlon );
+            if ( part[jlon] == mypart ) {
+                region.lat_begin[jlat] = std::min( region.lat_begin[jlat], jlon );
+                region.lat_end[jlat]   = std::max( region.lat_end[jlat], jlon );
             }
-            ++n;
         }
-        nb_region_nodes += region.lat_end.at( jlat ) - region.lat_begin.at( jlat ) + 1;
+        nb_region_nodes += region.lat_end[jlat] - region.lat_begin[jlat] + 1;
 
         // Count extra periodic node
         // if( periodic_east_west && size_t(region.lat_end.at(jlat)) == rg.nx(jlat)
@@ -927,6 +974,19 @@ void StructuredMeshGenerator::generate_mesh( const StructuredGrid& rg, const gri
     }
     int max_glb_idx = n;
 
+    // Local index of the first node of each latitude, so that latitudes can be filled independently
+    l = 0;
+    for ( idx_t jlat = region.north; jlat <= region.south; ++jlat ) {
+        offset_loc.at( jlat - region.north ) = l;
+        l += region.lat_end.at( jlat ) - region.lat_begin.at( jlat ) + 1;
+        if ( not include_periodic_ghost_points ) {
+            // Columns beyond the last point of the latitude are not added
+            l -= std::max<idx_t>(
+                0, region.lat_end.at( jlat ) - std::max( region.lat_begin.at( jlat ), rg.nx( jlat ) ) + 1 );
+        }
+    }
+    const idx_t nb_region_nodes = l;
+
     mesh.nodes().resize( nnodes );
     mesh::Nodes& nodes = mesh.nodes();
 
@@ -945,22 +1005,18 @@ void StructuredMeshGenerator::generate_mesh( const StructuredGrid& rg, const gri
         ghost_nodes.reserve( nnodes );
         idx_t node_number = 0;
         idx_t jnode       = 0;
-        l                 = 0;
         ATLAS_ASSERT( region.south >= region.north );
+        std::vector<int> lat_part( rg.nxmax() );
         for ( int jlat = region.north; jlat <= region.south; ++jlat ) {
-            int ilat              = jlat - region.north;
-            offset_loc.at( ilat ) = l;
-            l += region.lat_end.at( jlat ) - region.lat_begin.at( jlat ) + 1;
-
             if ( region.lat_end.at( jlat ) < region.lat_begin.at( jlat ) ) {
                 ATLAS_DEBUG_VAR( jlat );
                 ATLAS_DEBUG_VAR( region.lat_begin[jlat] );
                 ATLAS_DEBUG_VAR( region.lat_end[jlat] );
             }
+            distribution.partition( offset_glb.at( jlat ), offset_glb.at( jlat ) + rg.nx( jlat ), lat_part );
             for ( idx_t jlon = region.lat_begin.at( jlat ); jlon <= region.lat_end.at( jlat ); ++jlon ) {
                 if ( jlon < rg.nx( jlat ) ) {
-                    n = offset_glb.at( jlat ) + jlon;
-                    if ( distribution.partition( n ) == mypart ) {
+                    if ( lat_part[jlon] == mypart ) {
                         node_numbering.at( jnode ) = node_number;
                         ++node_number;
                     }
@@ -979,9 +1035,6 @@ void StructuredMeshGenerator::generate_mesh( const StructuredGrid& rg, const gri
                     ghost_nodes.emplace_back( jlat, rg.nx( jlat ), jnode );
                     ++jnode;
                 }
-                else {
-                    --l;
-                }
             }
         }
         for ( size_t jghost = 0; jghost < ghost_nodes.size(); ++jghost ) {
@@ -1005,18 +1058,17 @@ void StructuredMeshGenerator::generate_mesh( const StructuredGrid& rg, const gri
         }
     }
 
-    idx_t jnode = 0;
-    l           = 0;
-    for ( idx_t jlat = region.north; jlat <= region.south; ++jlat ) {
-        idx_t ilat            = jlat - region.north;
-        offset_loc.at( ilat ) = l;
-        l += region.lat_end.at( jlat ) - region.lat_begin.at( jlat ) + 1;
+    atlas_omp_parallel_for( idx_t jlat = region.north; jlat <= region.south; ++jlat ) {
+        idx_t jnode = offset_loc[jlat - region.north];
+
+        std::vector<int> lat_part( rg.nx( jlat ) );
+        distribution.partition( offset_glb[jlat], offset_glb[jlat] + rg.nx( jlat ), lat_part );
 
         double y = rg.y( jlat );
-        for ( idx_t jlon = region.lat_begin.at( jlat ); jlon <= region.lat_end.at( jlat ); ++jlon ) {
+        for ( idx_t jlon = region.lat_begin[jlat]; jlon <= region.lat_end[jlat]; ++jlon ) {
             if ( jlon < rg.nx( jlat ) ) {
-                idx_t inode = node_numbering.at( jnode );
-                n           = offset_glb.at( jlat ) + jlon;
+                idx_t inode = node_numbering[jnode];
+                int jglb    = offset_glb[jlat] + jlon;
 
                 double x = rg.x( jlon, jlat );
                 // std::cout << "jlat = " << jlat << "; jlon = " << jlon << "; x = " <<
@@ -1031,8 +1083,8 @@ void StructuredMeshGenerator::generate_mesh( const StructuredGrid& rg, const gri
                 lonlat( inode, LON ) = crd[LON];
                 lonlat( inode, LAT ) = crd[LAT];
 
-                glb_idx( inode ) = n + 1;
-                part( inode )    = distribution.partition( n );
+                glb_idx( inode ) = jglb + 1;
+                part( inode )    = lat_part[jlon];
                 ghost( inode )   = 0;
                 halo( inode )    = 0;
                 Topology::reset( flags( inode ) );
@@ -1064,7 +1116,7 @@ void StructuredMeshGenerator::generate_mesh( const StructuredGrid& rg, const gri
             }
             else if ( include_periodic_ghost_points )  // add periodic point
             {
-                idx_t inode = node_numbering.at( jnode );
+                idx_t inode = node_numbering[jnode];
                 // int inode_left = node_numbering.at(jnode-1);
                 double x = rg.x( rg.nx( jlat ), jlat );
 
@@ -1077,7 +1129,7 @@ void StructuredMeshGenerator::generate_mesh( const StructuredGrid& rg, const gri
                 lonlat( inode, LON ) = crd[LON];
                 lonlat( inode, LAT ) = crd[LAT];
 
-                glb_idx( inode ) = periodic_glb.at( jlat ) + 1;
+                glb_idx( inode ) = periodic_glb[jlat] + 1;
                 //#warning TODO: use commented approach
                 //        part(inode)      = parts.at( offset_glb.at(jlat) );
                 part( inode )  = mypart;  // The actual part will be fixed later
@@ -1104,12 +1156,10 @@ void StructuredMeshGenerator::generate_mesh( const StructuredGrid& rg, const gri
                 }
                 ++jnode;
             }
-            else {
-                --l;
-            }
         }
     }
 
+    idx_t jnode  = nb_region_nodes;
     idx_t jnorth = -1;
     if ( include_north_pole ) {
         idx_t inode     = node_numbering.at( jnode );
@@ -1184,13 +1234,20 @@ void StructuredMeshGenerator::generate_mesh( const StructuredGrid& rg, const gri
     /*
      * Fill in connectivity tables with global node indices first
      */
-    idx_t jcell;
     idx_t jquad       = 0;
     idx_t jtriag      = 0;
     idx_t quad_begin  = mesh.cells().elements( 0 ).begin();
     idx_t triag_begin = mesh.cells().elements( 1 ).begin();
-    idx_t quad_nodes[4];
-    idx_t triag_nodes[3];
+
+    // First quadrilateral and triangle of each latitude band, so that bands can be filled independently
+    std::vector<idx_t> lat_quad_begin( std::max( 0, region.south - region.north ) );
+    std::vector<idx_t> lat_triag_begin( lat_quad_begin.size() );
+    for ( idx_t jlat = region.north; jlat < region.south; ++jlat ) {
+        lat_quad_begin[jlat - region.north]  = quad_begin + jquad;
+        lat_triag_begin[jlat - region.north] = triag_begin + jtriag;
+        jquad += region.nb_lat_quads.at( jlat );
+        jtriag += region.nb_lat_elems.at( jlat ) - region.nb_lat_quads.at( jlat );
+    }
 
     auto fix_quad_orientation = []( idx_t nodes[] ) {
         idx_t tmp;
@@ -1209,28 +1266,35 @@ void StructuredMeshGenerator::generate_mesh( const StructuredGrid& rg, const gri
     };
 
 
-    for ( idx_t jlat = region.north; jlat < region.south; ++jlat ) {
-        idx_t ilat  = jlat - region.north;
-        idx_t jlatN = jlat;
-        idx_t jlatS = jlat + 1;
-        idx_t ilatN = ilat;
-        idx_t ilatS = ilat + 1;
-        for ( idx_t jelem = 0; jelem < region.nb_lat_elems.at( jlat ); ++jelem ) {
-            const auto elem = array::make_view<int, 3>( *region.elems ).slice( ilat, jelem, Range::all() );
+    const auto elemview = array::make_view<int, 3>( *region.elems );
+
+    atlas_omp_parallel_for( idx_t jlat = region.north; jlat < region.south; ++jlat ) {
+        idx_t ilat       = jlat - region.north;
+        idx_t jlatN      = jlat;
+        idx_t jlatS      = jlat + 1;
+        idx_t ilatN      = ilat;
+        idx_t ilatS      = ilat + 1;
+        idx_t jquad_lat  = lat_quad_begin[ilat];
+        idx_t jtriag_lat = lat_triag_begin[ilat];
+        idx_t jcell;
+        idx_t quad_nodes[4];
+        idx_t triag_nodes[3];
+        for ( idx_t jelem = 0; jelem < region.nb_lat_elems[jlat]; ++jelem ) {
+            const auto elem = elemview.slice( ilat, jelem, Range::all() );
 
             if ( elem( 2 ) >= 0 && elem( 3 ) >= 0 )  // This is a quad
             {
-                quad_nodes[0] = node_numbering.at( offset_loc.at( ilatN ) + elem( 0 ) - region.lat_begin.at( jlatN ) );
-                quad_nodes[1] = node_numbering.at( offset_loc.at( ilatS ) + elem( 1 ) - region.lat_begin.at( jlatS ) );
-                quad_nodes[2] = node_numbering.at( offset_loc.at( ilatS ) + elem( 2 ) - region.lat_begin.at( jlatS ) );
-                quad_nodes[3] = node_numbering.at( offset_loc.at( ilatN ) + elem( 3 ) - region.lat_begin.at( jlatN ) );
+                quad_nodes[0] = node_numbering[offset_loc[ilatN] + elem( 0 ) - region.lat_begin[jlatN]];
+                quad_nodes[1] = node_numbering[offset_loc[ilatS] + elem( 1 ) - region.lat_begin[jlatS]];
+                quad_nodes[2] = node_numbering[offset_loc[ilatS] + elem( 2 ) - region.lat_begin[jlatS]];
+                quad_nodes[3] = node_numbering[offset_loc[ilatN] + elem( 3 ) - region.lat_begin[jlatN]];
 
                 if ( three_dimensional && periodic_east_west ) {
                     if ( elem( 2 ) == rg.nx( jlatS ) ) {
-                        quad_nodes[2] = node_numbering.at( offset_loc.at( ilatS ) );
+                        quad_nodes[2] = node_numbering[offset_loc[ilatS]];
                     }
                     if ( elem( 3 ) == rg.nx( jlatN ) ) {
-                        quad_nodes[3] = node_numbering.at( offset_loc.at( ilatN ) );
+                        quad_nodes[3] = node_numbering[offset_loc[ilatN]];
                     }
                 }
 
@@ -1238,7 +1302,7 @@ void StructuredMeshGenerator::generate_mesh( const StructuredGrid& rg, const gri
                     fix_quad_orientation( quad_nodes );
                 }
 
-                jcell = quad_begin + jquad++;
+                jcell = jquad_lat++;
                 node_connectivity.set( jcell, quad_nodes );
                 cells_glb_idx( jcell ) = jcell + 1;
                 cells_part( jcell )    = mypart;
@@ -1247,18 +1311,15 @@ void StructuredMeshGenerator::generate_mesh( const StructuredGrid& rg, const gri
             {
                 if ( elem( 3 ) < 0 )  // This is a triangle pointing up
                 {
-                    triag_nodes[0] =
-                        node_numbering.at( offset_loc.at( ilatN ) + elem( 0 ) - region.lat_begin.at( jlatN ) );
-                    triag_nodes[1] =
-                        node_numbering.at( offset_loc.at( ilatS ) + elem( 1 ) - region.lat_begin.at( jlatS ) );
-                    triag_nodes[2] =
-                        node_numbering.at( offset_loc.at( ilatS ) + elem( 2 ) - region.lat_begin.at( jlatS ) );
+                    triag_nodes[0] = node_numbering[offset_loc[ilatN] + elem( 0 ) - region.lat_begin[jlatN]];
+                    triag_nodes[1] = node_numbering[offset_loc[ilatS] + elem( 1 ) - region.lat_begin[jlatS]];
+                    triag_nodes[2] = node_numbering[offset_loc[ilatS] + elem( 2 ) - region.lat_begin[jlatS]];
                     if ( three_dimensional && periodic_east_west ) {
                         if ( elem( 0 ) == rg.nx( jlatN ) ) {
-                            triag_nodes[0] = node_numbering.at( offset_loc.at( ilatN ) );
+                            triag_nodes[0] = node_numbering[offset_loc[ilatN]];
                         }
                         if ( elem( 2 ) == rg.nx( jlatS ) ) {
-                            triag_nodes[2] = node_numbering.at( offset_loc.at( ilatS ) );
+                            triag_nodes[2] = node_numbering[offset_loc[ilatS]];
                         }
                     }
                     if ( y_numbering > 0 ) {
@@ -1267,25 +1328,22 @@ void StructuredMeshGenerator::generate_mesh( const StructuredGrid& rg, const gri
                 }
                 else  // This is a triangle pointing down
                 {
-                    triag_nodes[0] =
-                        node_numbering.at( offset_loc.at( ilatN ) + elem( 0 ) - region.lat_begin.at( jlatN ) );
-                    triag_nodes[1] =
-                        node_numbering.at( offset_loc.at( ilatS ) + elem( 1 ) - region.lat_begin.at( jlatS ) );
-                    triag_nodes[2] =
-                        node_numbering.at( offset_loc.at( ilatN ) + elem( 3 ) - region.lat_begin.at( jlatN ) );
+                    triag_nodes[0] = node_numbering[offset_loc[ilatN] + elem( 0 ) - region.lat_begin[jlatN]];
+                    triag_nodes[1] = node_numbering[offset_loc[ilatS] + elem( 1 ) - region.lat_begin[jlatS]];
+                    triag_nodes[2] = node_numbering[offset_loc[ilatN] + elem( 3 ) - region.lat_begin[jlatN]];
                     if ( three_dimensional && periodic_east_west ) {
                         if ( elem( 1 ) == rg.nx( jlatS ) ) {
-                            triag_nodes[1] = node_numbering.at( offset_loc.at( ilatS ) );
+                            triag_nodes[1] = node_numbering[offset_loc[ilatS]];
                         }
                         if ( elem( 3 ) == rg.nx( jlatN ) ) {
-                            triag_nodes[2] = node_numbering.at( offset_loc.at( ilatN ) );
+                            triag_nodes[2] = node_numbering[offset_loc[ilatN]];
                         }
                     }
                     if ( y_numbering > 0 ) {
                         fix_triag_orientation( triag_nodes );
                     }
                 }
-                jcell = triag_begin + jtriag++;
+                jcell = jtriag_lat++;
                 node_connectivity.set( jcell, triag_nodes );
                 cells_glb_idx( jcell ) = jcell + 1;
                 cells_part( jcell )    = mypart;
@@ -1293,6 +1351,10 @@ void StructuredMeshGenerator::generate_mesh( const StructuredGrid& rg, const gri
         }
     }
 
+    idx_t jcell;
+    idx_t quad_nodes[4];
+    idx_t triag_nodes[3];
+
     if ( include_north_pole ) {
         idx_t ilat = 0;
         idx_t ip1  = 0;
@@ -8,11 +8,14 @@
  * nor does it submit to any jurisdiction.
  */
 
+#include <array>
 #include <cmath>
+#include <cstring>
 #include <fstream>
 #include <iostream>
 #include <limits>
 #include <stdexcept>
+#include <vector>
 
 #include "eckit/filesystem/PathName.h"
 
@@ -50,7 +53,10 @@ namespace {
 
 class GmshFile : public std::ofstream {
 public:
-    GmshFile( const PathName& file_path, std::ios_base::openmode mode, int part = static_cast<int>( mpi::rank() ) ) {
+    GmshFile( const PathName& file_path, std::ios_base::openmode mode, int part = static_cast<int>( mpi::rank() ) ) :
+        buffer_( 4 * 1024 * 1024 ) {
+        // Large stream buffer, so that formatted output is written to file in large blocks
+        rdbuf()->pubsetbuf( buffer_.data(), buffer_.size() );
         PathName par_path( file_path );
         int mpi_size = static_cast<int>( mpi::size() );
         if ( mpi::size() == 1 || part == -1 ) {
@@ -75,6 +81,40 @@ public:
             std::ofstream::open( path.localPath(), mode );
         }
     }
+
+    // Flush before the buffer is destroyed
+    ~GmshFile() { close(); }
+
+private:
+    std::vector<char> buffer_;
+};
+
+/// Accumulates binary records, which are written to the stream in large blocks
+class BinaryBuffer {
+public:
+    BinaryBuffer( std::ostream& out ) : out_( out ) {}
+
+    ~BinaryBuffer() { flush(); }
+
+    template <typename T>
+    void write( const T& value ) {
+        const size_t position = buffer_.size();
+        buffer_.resize( position + sizeof( T ) );
+        std::memcpy( buffer_.data() + position, &value, sizeof( T ) );
+        if ( buffer_.size() >= capacity_ ) {
+            flush();
+        }
+    }
+
+    void flush() {
+        out_.write( buffer_.data(), buffer_.size() );
+        buffer_.clear();
+    }
+
+private:
+    static constexpr size_t capacity_ = 64 * 1024 * 1024;
+    std::ostream& out_;
+    std::vector<char> buffer_;
 };
 
 enum GmshElementTypes
@@ -126,78 +166,76 @@ array::LocalView<const T, 2> make_level_view( const Field& field, int ndata, int
     }
 }
 
+/// Components of a value as written by gmsh: a scalar, a vector of 3 or a tensor of 9 components
+template <typename Value, typename Components>
+int gmsh_components( const array::LocalView<Value, 2>& data, idx_t n, Components& components ) {
+    const idx_t nvars = data.shape( 1 );
+    if ( nvars == 1 ) {
+        components[0] = data( n, 0 );
+        return 1;
+    }
+    if ( nvars <= 3 ) {
+        for ( idx_t v = 0; v < 3; ++v ) {
+            components[v] = v < nvars ? data( n, v ) : 0;
+        }
+        return 3;
+    }
+    if ( nvars == 4 ) {
+        components.fill( 0 );
+        for ( int i = 0; i < 2; ++i ) {
+            for ( int j = 0; j < 2; ++j ) {
+                components[i * 3 + j] = data( n, i * 2 + j );
+            }
+        }
+        return 9;
+    }
+    if ( nvars == 9 ) {
+        for ( int v = 0; v < 9; ++v ) {
+            components[v] = data( n, v );
+        }
+        return 9;
+    }
+    ATLAS_NOTIMPLEMENTED;
+}
+
 template <typename Value, typename GlobalIndex, typename IncludeIndex>
-void write_level( std::ostream& out, GlobalIndex gidx, const array::LocalView<Value, 2>& data, IncludeIndex include ) {
+void write_level( std::ostream& out, bool binary, GlobalIndex gidx, const array::LocalView<Value, 2>& data,
+                  IncludeIndex include ) {
     using value_type = typename std::remove_const<Value>::type;
-    int ndata        = data.shape( 0 );
-    int nvars        = data.shape( 1 );
-    if ( nvars == 1 ) {
+    const idx_t ndata = data.shape( 0 );
+    if ( binary ) {
+        // Records of the integer index followed by the components in double precision
+        std::array<double, 9> components;
+        BinaryBuffer buffer( out );
         for ( idx_t n = 0; n < ndata; ++n ) {
             if ( include( n ) ) {
-                out << gidx( n ) << " " << data( n, 0 ) << "\n";
+                const int ncomponents = gmsh_components( data, n, components );
+                buffer.write( static_cast<int>( gidx( n ) ) );
+                for ( int v = 0; v < ncomponents; ++v ) {
+                    buffer.write( components[v] );
+                }
             }
         }
+        buffer.flush();
+        out << "\n";
     }
-    else if ( nvars <= 3 ) {
-        std::array<value_type, 3> data_vec;
+    else {
+        std::array<value_type, 9> components;
         for ( idx_t n = 0; n < ndata; ++n ) {
             if ( include( n ) ) {
-                for ( idx_t v = 0; v < nvars; ++v ) {
-                    data_vec[v] = data( n, v );
-                }
+                const int ncomponents = gmsh_components( data, n, components );
                 out << gidx( n );
-                for ( int v = 0; v < 3; ++v ) {
-                    out << " " << data_vec[v];
+                for ( int v = 0; v < ncomponents; ++v ) {
+                    out << " " << components[v];
                 }
                 out << "\n";
             }
         }
     }
-    else if ( nvars <= 9 ) {
-        std::array<value_type, 9> data_vec;
-        if ( nvars == 4 ) {
-            for ( int n = 0; n < ndata; ++n ) {
-                if ( include( n ) ) {
-                    for ( int i = 0; i < 2; ++i ) {
-                        for ( int j = 0; j < 2; ++j ) {
-                            data_vec[i * 3 + j] = data( n, i * 2 + j );
-                        }
-                    }
-                    out << gidx( n );
-                    for ( int v = 0; v < 9; ++v ) {
-                        out << " " << data_vec[v];
-                    }
-                    out << "\n";
-                }
-            }
-        }
-        else if ( nvars == 9 ) {
-            for ( int n = 0; n < ndata; ++n ) {
-                if ( include( n ) ) {
-                    for ( int i = 0; i < 3; ++i ) {
-                        for ( int j = 0; j < 3; ++j ) {
-                            data_vec[i * 3 + j] = data( n, i * 2 + j );
-                        }
-                    }
-                    out << gidx( n );
-                    for ( int v = 0; v < 9; ++v ) {
-                        out << " " << data_vec[v];
-                    }
-                    out << "\n";
-                }
-            }
-        }
-        else {
-            ATLAS_NOTIMPLEMENTED;
-        }
-    }
-    else {
-        ATLAS_NOTIMPLEMENTED;
-    }
 }
 template <typename Value, typename GlobalIndex>
-void write_level( std::ostream& out, GlobalIndex gidx, const array::LocalView<Value, 2>& data ) {
-    write_level( out, gidx, data, []( idx_t ) { return true; } );
+void write_level( std::ostream& out, bool binary, GlobalIndex gidx, const array::LocalView<Value, 2>& data ) {
+    write_level( out, binary, gidx, data, []( idx_t ) { return true; } );
 }
 
 std::vector<int> get_levels( int nlev, const Metadata& gmsh_options ) {
@@ -259,7 +297,7 @@ void write_field_nodes( const Metadata& gmsh_options, const functionspace::NodeC
     Log::debug() << "writing NodeColumns field " << field.name() << " defined in NodeColumns..." << std::endl;
 
     bool gather( gmsh_options.get<bool>( "gather" ) && mpi::size() > 1 );
-    // unused: bool binary( !gmsh_options.get<bool>( "ascii" ) );
+    bool binary( !gmsh_options.get<bool>( "ascii" ) );
     idx_t nlev  = std::max<idx_t>( 1, field.levels() );
     idx_t ndata = std::min<idx_t>( function_space.nb_nodes(), field.shape( 0 ) );
     idx_t nvars = std::max<idx_t>( 1, field.variables() );
@@ -314,10 +352,10 @@ void write_field_nodes( const Metadata& gmsh_options, const functionspace::NodeC
             out << ndata_nonmissing << "\n";
             out << mpi::rank() << "\n";
             if ( missing ) {
-                write_level( out, gidx, data, include_idx );
+                write_level( out, binary, gidx, data, include_idx );
             }
             else {
-                write_level( out, gidx, data );
+                write_level( out, binary, gidx, data );
             }
             out << "$EndNodeData\n";
         }
@@ -330,7 +368,7 @@ void write_field_nodes( const Metadata& gmsh_options, const functionspace::NoFun
                         const Field& field, std::ostream& out ) {
     Log::debug() << "writing field " << field.name() << " defined without functionspace..." << std::endl;
 
-    // unused: bool binary( !gmsh_options.get<bool>( "ascii" ) );
+    bool binary( !gmsh_options.get<bool>( "ascii" ) );
     idx_t nlev  = std::max<idx_t>( 1, field.levels() );
     idx_t ndata = field.shape( 0 );
     idx_t nvars = std::max<idx_t>( 1, field.variables() );
@@ -373,10 +411,10 @@ void write_field_nodes( const Metadata& gmsh_options, const functionspace::NoFun
         out << ndata_nonmissing << "\n";
         out << mpi::rank() << "\n";
         if ( missing ) {
-            write_level( out, gidx, data, include_idx );
+            write_level( out, binary, gidx, data, include_idx );
         }
         else {
-            write_level( out, gidx, data );
+            write_level( out, binary, gidx, data );
         }
         out << "$EndNodeData\n";
     }
@@ -407,7 +445,7 @@ void write_field_nodes( const Metadata& gmsh_options, const functionspace::Struc
     Log::debug() << "writing StructuredColumns field " << field.name() << "..." << std::endl;
 
     bool gather( gmsh_options.get<bool>( "gather" ) && mpi::size() > 1 );
-    // unused: bool binary( !gmsh_options.get<bool>( "ascii" ) );
+    bool binary( !gmsh_options.get<bool>( "ascii" ) );
     idx_t nlev  = std::max<idx_t>( 1, field.levels() );
     idx_t ndata = std::min<idx_t>( function_space.sizeOwned(), field.shape( 0 ) );
     idx_t nvars = std::max<idx_t>( 1, field.variables() );
@@ -430,6 +468,9 @@ void write_field_nodes( const Metadata& gmsh_options, const functionspace::Struc
         int jlev          = lev[ilev];
         char field_lev[6] = {0, 0, 0, 0, 0, 0};
 
+        if ( gather && mpi::rank() != 0 ) {
+            continue;
+        }
         if ( field.levels() ) {
             print_field_lev( field_lev, jlev );
         }
@@ -446,7 +487,7 @@ void write_field_nodes( const Metadata& gmsh_options, const functionspace::Struc
         out << mpi::rank() << "\n";
         auto data = gather ? make_level_view<DATATYPE>( field_glb, ndata, jlev )
                            : make_level_view<DATATYPE>( field, ndata, jlev );
-        write_level( out, gidx, data );
+        write_level( out, binary, gidx, data );
         out << "$EndNodeData\n";
     }
 }
@@ -459,7 +500,7 @@ void write_field_elems( const Metadata& gmsh_options, const functionspace::CellC
     Log::debug() << "writing CellColumns field " << field.name() << "..." << std::endl;
 
     bool gather( gmsh_options.get<bool>( "gather" ) && mpi::size() > 1 );
-    // unused: bool binary( !gmsh_options.get<bool>( "ascii" ) );
+    bool binary( !gmsh_options.get<bool>( "ascii" ) );
     idx_t nlev  = std::max<idx_t>( 1, field.levels() );
     idx_t ndata = std::min<idx_t>( function_space.nb_cells(), field.shape( 0 ) );
     idx_t nvars = std::max<idx_t>( 1, field.variables() );
@@ -493,7 +534,7 @@ void write_field_elems( const Metadata& gmsh_options, const functionspace::CellC
             out << mpi::rank() << "\n";
             auto data = gather ? make_level_view<DATATYPE>( field_glb, ndata, jlev )
                                : make_level_view<DATATYPE>( field, ndata, jlev );
-            write_level( out, gidx, data );
+            write_level( out, binary, gidx, data );
             out << "$EndElementData\n";
         }
     }
@@ -942,6 +983,7 @@ void GmshIO::write( const Mesh& mesh, const PathName& file_path ) const {
     file << "$Nodes\n";
     file << nb_nodes << "\n";
     double xyz[3] = {0., 0., 0.};
+    BinaryBuffer nodes_buffer( file );
     for ( idx_t n = 0; n < nb_nodes; ++n ) {
         gidx_t g = glb_idx( n );
 
@@ -957,14 +999,16 @@ void GmshIO::write( const Mesh& mesh, const PathName& file_path ) const {
         }
 
         if ( binary ) {
-            file.write( reinterpret_cast<const char*>( &g ), sizeof( gidx_t ) );
-            file.write( reinterpret_cast<const char*>( &xyz ), sizeof( double ) * 3 );
+            // Node numbers are of type int in the gmsh binary format
+            nodes_buffer.write( static_cast<int>( g ) );
+            nodes_buffer.write( xyz );
         }
         else {
             file << g << " " << xyz[XX] << " " << xyz[YY] << " " << xyz[ZZ] << "\n";
         }
     }
     if ( binary ) {
+        nodes_buffer.flush();
         file << "\n";
     }
     file << "$EndNodes\n";
@@ -1073,33 +1117,26 @@ void GmshIO::write( const Mesh& mesh, const PathName& file_path ) const {
                     return true;
                 };
                 if ( binary ) {
-                    idx_t nb_elems = elements.size();
-                    if ( !include_ghost ) {
-                        for ( idx_t elem = 0; elem < elements.size(); ++elem ) {
-                            if ( elems_halo( elem ) ) {
-                                --nb_elems;
-                            }
-                        }
+                    idx_t nb_elems = 0;
+                    for ( idx_t elem = 0; elem < elements.size(); ++elem ) {
+                        nb_elems += include( elem );
+                    }
+                    if ( nb_elems == 0 ) {
+                        continue;
                     }
 
-                    int header[3];
-                    int data[9];
-                    header[0] = gmsh_elem_type;
-                    header[1] = nb_elems;
-                    header[2] = 4;  // nb_tags
-                    file.write( reinterpret_cast<const char*>( &header ), sizeof( int ) * 3 );
-                    data[1]         = 1;
-                    data[2]         = 1;
-                    data[3]         = 1;
-                    size_t datasize = sizeof( int ) * ( 5 + node_connectivity.cols() );
-                    for ( idx_t elem = 0; elem < nb_elems; ++elem ) {
-                        if ( include_ghost || !elems_halo( elem ) ) {
-                            data[0] = elems_glb_idx( elem );
-                            data[4] = elems_partition( elem );
+                    // Block of elements of one type, with 4 tags per element
+                    const int header[3] = {gmsh_elem_type, static_cast<int>( nb_elems ), 4};
+                    BinaryBuffer buffer( file );
+                    buffer.write( header );
+                    for ( idx_t elem = 0; elem < elements.size(); ++elem ) {
+                        if ( include( elem ) ) {
+                            const int data[5] = {static_cast<int>( elems_glb_idx( elem ) ), 1, 1, 1,
+                                                 elems_partition( elem )};
+                            buffer.write( data );
                             for ( idx_t n = 0; n < node_connectivity.cols(); ++n ) {
-                                data[5 + n] = glb_idx( node_connectivity( elem, n ) );
+                                buffer.write( static_cast<int>( glb_idx( node_connectivity( elem, n ) ) ) );
                             }
-                            file.write( reinterpret_cast<const char*>( &data ), datasize );
                         }
                     }
                 }
@@ -1242,7 +1279,12 @@ void GmshIO::write_delegate( const FieldSet& fieldset, const functionspace::Node
 
     // Header
     if ( is_new_file ) {
-        write_header_ascii( file );
+        if ( binary ) {
+            write_header_binary( file );
+        }
+        else {
+            write_header_ascii( file );
+        }
     }
 
     // field::Fields
@@ -1280,7 +1322,12 @@ void GmshIO::write_delegate( const FieldSet& fieldset, const functionspace::NoFu
 
     // Header
     if ( is_new_file ) {
-        write_header_ascii( file );
+        if ( binary ) {
+            write_header_binary( file );
+        }
+        else {
+            write_header_ascii( file );
+        }
     }
 
     // field::Fields
@@ -1318,7 +1365,12 @@ void GmshIO::write_delegate( const FieldSet& fieldset, const functionspace::Cell
 
     // Header
     if ( is_new_file ) {
-        write_header_ascii( file );
+        if ( binary ) {
+            write_header_binary( file );
+        }
+        else {
+            write_header_ascii( file );
+        }
     }
 
     // field::Fields
@@ -1361,7 +1413,12 @@ void GmshIO::write_delegate( const FieldSet& fieldset, const functionspace::Stru
 
     // Header
     if ( is_new_file ) {
-        write_header_ascii( file );
+        if ( binary ) {
+            write_header_binary( file );
+        }
+        else {
+            write_header_ascii( file );
+        }
     }
 
     // field::Fields
@@ -10,17 +10,29 @@
 
 #include <cstring>
 
+#include "eckit/config/Resource.h"
+
 #include "atlas/parallel/Checksum.h"
+#include "atlas/parallel/mpi/Statistics.h"
 
 namespace atlas {
 namespace parallel {
 
+namespace {
+bool default_order_independent() {
+    static bool order_independent = eckit::Resource<bool>( "$ATLAS_CHECKSUM_REDUCE", false );
+    return order_independent;
+}
+}  // namespace
+
 Checksum::Checksum() : name_() {
-    is_setup_ = false;
+    is_setup_          = false;
+    order_independent_ = default_order_independent();
 }
 
 Checksum::Checksum( const std::string& name ) : name_( name ) {
-    is_setup_ = false;
+    is_setup_          = false;
+    order_independent_ = default_order_independent();
 }
 
 void Checksum::setup( const int part[], const idx_t remote_idx[], const int base, const gidx_t glb_idx[],
@@ -45,6 +57,18 @@ void Checksum::setup( const util::ObjectHandle<GatherScatter>& gather ) {
     is_setup_ = true;
 }
 
+void Checksum::order_independent( bool value ) {
+    order_independent_ = value;
+}
+
+std::string Checksum::allreduce( util::checksum_t local_checksum ) const {
+    util::checksum_t glb_checksum;
+    ATLAS_TRACE_MPI( ALLREDUCE, mpi::Volume( 1, sizeof( util::checksum_t ) ) ) {
+        mpi::comm().allReduce( local_checksum, glb_checksum, eckit::mpi::sum() );
+    }
+    return eckit::Translator<util::checksum_t, std::string>()( glb_checksum );
+}
+
 /////////////////////
 
 Checksum* atlas__Checksum__new() {
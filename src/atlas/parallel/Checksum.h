@@ -58,6 +58,14 @@ public:  // methods
     /// @brief Setup
     void setup( const util::ObjectHandle<GatherScatter>& );
 
+    /// @brief Combine the checksums of points with a commutative sum and an allreduce, instead of gathering them
+    ///
+    /// Each owned point contributes a hash of its values mixed with its position in the global ordering.
+    /// The result does not depend on the domain decomposition, and requires no gather, but it differs from
+    /// the checksum computed by gathering. Defaults to the value of environment variable ATLAS_CHECKSUM_REDUCE.
+    void order_independent( bool );
+    bool order_independent() const { return order_independent_; }
+
     template <typename DATA_TYPE>
     std::string execute( const DATA_TYPE lfield[], const int lvar_strides[], const int lvar_extents[],
                          const int lvar_rank ) const;
@@ -72,10 +80,25 @@ public:  // methods
     void var_info( const array::ArrayView<DATA_TYPE, RANK>& arr, std::vector<int>& varstrides,
                    std::vector<int>& varextents ) const;
 
+private:  // methods
+    static util::checksum_t combine( idx_t glb_pos, util::checksum_t point_checksum ) {
+        // 64-bit finalizer of MurmurHash3, so that the sum of contributions does not cancel out
+        util::checksum_t h = point_checksum ^ ( util::checksum_t( glb_pos ) * 0x9e3779b97f4a7c15ULL );
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        h *= 0xc4ceb9fe1a85ec53ULL;
+        h ^= h >> 33;
+        return h;
+    }
+
+    std::string allreduce( util::checksum_t local_checksum ) const;
+
 private:  // data
     std::string name_;
     util::ObjectHandle<GatherScatter> gather_;
     bool is_setup_;
+    bool order_independent_;
     size_t parsize_;
 };
 
@@ -87,9 +110,21 @@ std::string Checksum::execute( const DATA_TYPE data[], const int var_strides[],
     if ( !is_setup_ ) {
         throw_Exception( "Checksum was not setup", Here() );
     }
-    std::vector<util::checksum_t> local_checksums( parsize_ );
     int var_size = var_extents[0] * var_strides[0];
 
+    if ( order_independent_ ) {
+        const GatherScatter& gather = *gather_;
+        const int* glb_pos          = gather.glbmap_.data() + gather.glbdispls_[gather.myproc];
+        util::checksum_t local_checksum{0};
+        for ( int k = 0; k < gather.loccnt_; ++k ) {
+            const idx_t pp = gather.locmap_[k];
+            local_checksum += combine( glb_pos[k], util::checksum( data + pp * var_size, var_size ) );
+        }
+        return allreduce( local_checksum );
+    }
+
+    std::vector<util::checksum_t> local_checksums( parsize_ );
+
     for ( size_t pp = 0; pp < parsize_; ++pp ) {
         local_checksums[pp] = util::checksum( data + pp * var_size, var_size );
     }
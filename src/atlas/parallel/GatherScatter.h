@@ -10,9 +10,12 @@
 
 #pragma once
 
+#include <algorithm>
+#include <deque>
 #include <numeric>
 #include <stdexcept>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "atlas/array/ArrayView.h"
@@ -137,6 +140,16 @@ public:  // methods
     void gather( parallel::Field<DATA_TYPE const> lfields[], parallel::Field<DATA_TYPE> gfields[],
                  const idx_t nb_fields, const idx_t root = 0 ) const;
 
+    /// @brief Gather every field on its own root task
+    ///
+    /// Field jfield is gathered on task roots[jfield]. All gathers are posted at once with non-blocking
+    /// point-to-point communication, so that different roots receive their global fields concurrently,
+    /// e.g. with fields assigned round-robin to output tasks. At most a few packed local fields are being
+    /// sent at any time, and each of their buffers is released as soon as its send completes.
+    template <typename DATA_TYPE>
+    void gather( parallel::Field<DATA_TYPE const> lfields[], parallel::Field<DATA_TYPE> gfields[],
+                 const idx_t nb_fields, const std::vector<idx_t>& roots ) const;
+
     template <typename DATA_TYPE, int LRANK, int GRANK>
     void gather( const array::ArrayView<DATA_TYPE, LRANK>& ldata, array::ArrayView<DATA_TYPE, GRANK>& gdata,
                  const idx_t root = 0 ) const;
@@ -231,7 +244,10 @@ void GatherScatter::gather( parallel::Field<DATA_TYPE const> lfields[], parallel
 
         /// Gather
 
-        ATLAS_TRACE_MPI( GATHER ) { mpi::comm().gatherv( loc_buffer, glb_buffer, glb_counts, glb_displs, root ); }
+        const size_t bytes = ( myproc == root ? glb_size : loc_size ) * sizeof( DATA_TYPE );
+        ATLAS_TRACE_MPI( GATHER, mpi::Volume( 1, bytes ) ) {
+            mpi::comm().gatherv( loc_buffer, glb_buffer, glb_counts, glb_displs, root );
+        }
 
         /// Unpack
         if ( myproc == root )
@@ -239,6 +255,100 @@ void GatherScatter::gather( parallel::Field<DATA_TYPE const> lfields[], parallel
     }
 }
 
+template <typename DATA_TYPE>
+void GatherScatter::gather( parallel::Field<DATA_TYPE const> lfields[], parallel::Field<DATA_TYPE> gfields[],
+                            const idx_t nb_fields, const std::vector<idx_t>& roots ) const {
+    if ( !is_setup_ ) {
+        throw_Exception( "GatherScatter was not setup", Here() );
+    }
+    ATLAS_ASSERT( static_cast<idx_t>( roots.size() ) == nb_fields );
+    if ( nb_fields == 1 ) {
+        gather( lfields, gfields, nb_fields, roots[0] );
+        return;
+    }
+
+    const int tag = 0;  // Messages between two tasks are matched in the order the fields are posted
+    // Sends in flight, each with its packed local field. All receives are posted before any send is waited for,
+    // so waiting for the oldest send to make room for the next one cannot deadlock.
+    const size_t max_sends_in_flight = 4;
+    std::deque<std::pair<eckit::mpi::Request, std::vector<DATA_TYPE>>> sends;
+    std::vector<std::vector<DATA_TYPE>> glb_buffers( nb_fields );
+    std::vector<eckit::mpi::Request> recv_requests;
+
+    /// Post receives for the fields gathered on this task
+
+    for ( idx_t jfield = 0; jfield < nb_fields; ++jfield ) {
+        if ( roots[jfield] != myproc ) {
+            continue;
+        }
+        const size_t gvar_size =
+            std::accumulate( gfields[jfield].var_shape.data(),
+                             gfields[jfield].var_shape.data() + gfields[jfield].var_rank, 1, std::multiplies<idx_t>() );
+        std::vector<DATA_TYPE>& glb_buffer = glb_buffers[jfield];
+        glb_buffer.resize( glbcnt_ * gvar_size );
+        std::vector<size_t> recv_counts( nproc, 0 );
+        for ( idx_t jproc = 0; jproc < nproc; ++jproc ) {
+            if ( jproc != myproc ) {
+                recv_counts[jproc] = glbcounts_[jproc] * gvar_size;
+            }
+        }
+        ATLAS_TRACE_MPI( IRECEIVE, mpi::Volume::of<DATA_TYPE>( recv_counts ) ) {
+            for ( idx_t jproc = 0; jproc < nproc; ++jproc ) {
+                if ( recv_counts[jproc] > 0 ) {
+                    recv_requests.push_back( mpi::comm().iReceive( glb_buffer.data() + glbdispls_[jproc] * gvar_size,
+                                                                   recv_counts[jproc], jproc, tag ) );
+                }
+            }
+        }
+    }
+
+    /// Pack and send
+
+    for ( idx_t jfield = 0; jfield < nb_fields; ++jfield ) {
+        const size_t lvar_size =
+            std::accumulate( lfields[jfield].var_shape.data(),
+                             lfields[jfield].var_shape.data() + lfields[jfield].var_rank, 1, std::multiplies<idx_t>() );
+        if ( roots[jfield] == myproc ) {
+            pack_send_buffer( lfields[jfield], locmap_, glb_buffers[jfield].data() + glbdispls_[myproc] * lvar_size );
+        }
+        else if ( loccnt_ > 0 ) {
+            if ( sends.size() == max_sends_in_flight ) {
+                ATLAS_TRACE_MPI( WAIT, "mpi-wait send" ) { mpi::comm().wait( sends.front().first ); }
+                sends.pop_front();  // releases its buffer
+            }
+            std::vector<DATA_TYPE> loc_buffer( loccnt_ * lvar_size );
+            pack_send_buffer( lfields[jfield], locmap_, loc_buffer.data() );
+            ATLAS_TRACE_MPI( ISEND, mpi::Volume( 1, loc_buffer.size() * sizeof( DATA_TYPE ) ) ) {
+                eckit::mpi::Request request =
+                    mpi::comm().iSend( loc_buffer.data(), loc_buffer.size(), roots[jfield], tag );
+                sends.emplace_back( request, std::move( loc_buffer ) );
+            }
+        }
+    }
+
+    /// Wait for receiving to finish, and unpack
+
+    ATLAS_TRACE_MPI( WAIT, "mpi-wait receive" ) {
+        for ( auto& request : recv_requests ) {
+            mpi::comm().wait( request );
+        }
+    }
+    for ( idx_t jfield = 0; jfield < nb_fields; ++jfield ) {
+        if ( roots[jfield] == myproc ) {
+            unpack_recv_buffer( glbmap_, glb_buffers[jfield].data(), gfields[jfield] );
+            std::vector<DATA_TYPE>().swap( glb_buffers[jfield] );
+        }
+    }
+
+    /// Wait for sending to finish
+
+    ATLAS_TRACE_MPI( WAIT, "mpi-wait send" ) {
+        for ( auto& send : sends ) {
+            mpi::comm().wait( send.first );
+        }
+    }
+}
+
 template <typename DATA_TYPE>
 void GatherScatter::gather( const DATA_TYPE ldata[], const idx_t lvar_strides[], const idx_t lvar_shape[],
                             const idx_t lvar_rank, DATA_TYPE gdata[], const idx_t gvar_strides[],
@@ -280,7 +390,8 @@ void GatherScatter::scatter( parallel::Field<DATA_TYPE const> gfields[], paralle
 
         /// Scatter
 
-        ATLAS_TRACE_MPI( SCATTER ) {
+        const size_t bytes = ( myproc == root ? glb_size : loc_size ) * sizeof( DATA_TYPE );
+        ATLAS_TRACE_MPI( SCATTER, mpi::Volume( 1, bytes ) ) {
             mpi::comm().scatterv( glb_buffer.begin(), glb_buffer.end(), glb_counts, glb_displs, loc_buffer.begin(),
                                   loc_buffer.end(), root );
         }
@@ -20,6 +20,7 @@
 #include "atlas/array/Array.h"
 #include "atlas/parallel/HaloExchange.h"
 #include "atlas/parallel/mpi/Statistics.h"
+#include "atlas/parallel/omp/omp.h"
 #include "atlas/util/vector.h"
 
 namespace atlas {
@@ -70,6 +71,10 @@ void HaloExchange::setup( const int part[], const idx_t remote_idx[], const int
                           idx_t halo_begin ) {
     ATLAS_TRACE( "HaloExchange::setup" );
 
+    if ( persistent_.in_progress ) {
+        throw_Exception( "HaloExchange::setup called while an exchange is in progress", Here() );
+    }
+
     parsize_ = parsize;
     sendcounts_.resize( nproc );
     sendcounts_.assign( nproc, 0 );
@@ -156,11 +161,291 @@ void HaloExchange::setup( const int part[], const idx_t remote_idx[], const int
         sendmap_[jj] = recv_requests[jj];
     }
 
+    persistent_.var_size = -1;
+    persistent_.send_counts_init.resize( nproc );
+    persistent_.recv_counts_init.resize( nproc );
+    persistent_.send_counts.resize( nproc );
+    persistent_.recv_counts.resize( nproc );
+    persistent_.send_displs.resize( nproc );
+    persistent_.recv_displs.resize( nproc );
+    persistent_.send_req.resize( nproc );
+    persistent_.recv_req.resize( nproc );
+
     is_setup_        = true;
     backdoor.parsize = parsize_;
 }
 
-void HaloExchange::wait_for_send( std::vector<int>& send_counts_init,
+void HaloExchange::release_buffers() const {
+    if ( persistent_.in_progress ) {
+        throw_Exception( "HaloExchange::release_buffers called while an exchange is in progress", Here() );
+    }
+    std::vector<char>().swap( persistent_.send_buffer );
+    std::vector<char>().swap( persistent_.recv_buffer );
+}
+
+void HaloExchange::persistent_discard() const {
+    wait_for_receive( persistent_.recv_counts_init, persistent_.recv_req );
+    wait_for_send( persistent_.send_counts_init, persistent_.send_req );
+    persistent_.in_progress = false;
+}
+
+void HaloExchange::persistent_counts_displs_setup( const idx_t var_size ) const {
+    if ( var_size == persistent_.var_size ) {
+        return;
+    }
+    for ( int jproc = 0; jproc < nproc; ++jproc ) {
+        persistent_.send_counts_init[jproc] = sendcounts_[jproc];
+        persistent_.recv_counts_init[jproc] = recvcounts_[jproc];
+        persistent_.send_counts[jproc]      = sendcounts_[jproc] * var_size;
+        persistent_.recv_counts[jproc]      = recvcounts_[jproc] * var_size;
+        persistent_.send_displs[jproc]      = senddispls_[jproc] * var_size;
+        persistent_.recv_displs[jproc]      = recvdispls_[jproc] * var_size;
+    }
+    persistent_.var_size = var_size;
+}
+
+namespace {
+
+// Byte offsets of fused message segments are aligned for the widest supported data type
+constexpr size_t fused_alignment = 8;
+
+size_t fused_align( size_t offset ) {
+    return ( ( offset + fused_alignment - 1 ) / fused_alignment ) * fused_alignment;
+}
+
+size_t fused_bytes_per_point( const array::Array& array ) {
+    size_t bytes = array.datatype().size();
+    for ( idx_t j = 1; j < array.rank(); ++j ) {
+        bytes *= array.shape( j );
+    }
+    return bytes;
+}
+
+bool fused_supported( const array::Array& array ) {
+    if ( array.rank() < 1 || array.rank() > 4 ) {
+        return false;
+    }
+    return array.datatype() == array::DataType::kind<int>() || array.datatype() == array::DataType::kind<long>() ||
+           array.datatype() == array::DataType::kind<float>() || array.datatype() == array::DataType::kind<double>();
+}
+
+template <typename DATA_TYPE, int RANK>
+struct FusedPacker {
+    static void pack( array::Array& array, const array::SVector<int>& map, int begin, int end, char* buffer ) {
+        auto field            = array::make_host_view<DATA_TYPE, RANK>( array );
+        DATA_TYPE* buffer_ptr = reinterpret_cast<DATA_TYPE*>( buffer );
+        idx_t ibuf            = 0;
+        for ( int node_cnt = begin; node_cnt < end; ++node_cnt ) {
+            halo_packer_impl<0, RANK, 0>::apply( ibuf, map[node_cnt], field, buffer_ptr );
+        }
+    }
+    static void unpack( const char* buffer, const array::SVector<int>& map, int begin, int end,
+                        array::Array& array ) {
+        auto field                  = array::make_host_view<DATA_TYPE, RANK>( array );
+        const DATA_TYPE* buffer_ptr = reinterpret_cast<const DATA_TYPE*>( buffer );
+        idx_t ibuf                  = 0;
+        for ( int node_cnt = begin; node_cnt < end; ++node_cnt ) {
+            halo_unpacker_impl<0, RANK, 0>::apply( ibuf, map[node_cnt], buffer_ptr, field );
+        }
+    }
+};
+
+template <typename DATA_TYPE>
+void fused_pack( array::Array& array, const array::SVector<int>& map, int begin, int end, char* buffer ) {
+    switch ( array.rank() ) {
+        case 1:
+            FusedPacker<DATA_TYPE, 1>::pack( array, map, begin, end, buffer );
+            break;
+        case 2:
+            FusedPacker<DATA_TYPE, 2>::pack( array, map, begin, end, buffer );
+            break;
+        case 3:
+            FusedPacker<DATA_TYPE, 3>::pack( array, map, begin, end, buffer );
+            break;
+        case 4:
+            FusedPacker<DATA_TYPE, 4>::pack( array, map, begin, end, buffer );
+            break;
+        default:
+            // rank is validated by fused_supported() before packing
+            break;
+    }
+}
+
+template <typename DATA_TYPE>
+void fused_unpack( const char* buffer, const array::SVector<int>& map, int begin, int end, array::Array& array ) {
+    switch ( array.rank() ) {
+        case 1:
+            FusedPacker<DATA_TYPE, 1>::unpack( buffer, map, begin, end, array );
+            break;
+        case 2:
+            FusedPacker<DATA_TYPE, 2>::unpack( buffer, map, begin, end, array );
+            break;
+        case 3:
+            FusedPacker<DATA_TYPE, 3>::unpack( buffer, map, begin, end, array );
+            break;
+        case 4:
+            FusedPacker<DATA_TYPE, 4>::unpack( buffer, map, begin, end, array );
+            break;
+        default:
+            // rank is validated by fused_supported() before packing
+            break;
+    }
+}
+
+void fused_pack( array::Array& array, const array::SVector<int>& map, int begin, int end, char* buffer ) {
+    if ( array.datatype() == array::DataType::kind<int>() ) {
+        fused_pack<int>( array, map, begin, end, buffer );
+    }
+    else if ( array.datatype() == array::DataType::kind<long>() ) {
+        fused_pack<long>( array, map, begin, end, buffer );
+    }
+    else if ( array.datatype() == array::DataType::kind<float>() ) {
+        fused_pack<float>( array, map, begin, end, buffer );
+    }
+    else if ( array.datatype() == array::DataType::kind<double>() ) {
+        fused_pack<double>( array, map, begin, end, buffer );
+    }
+    // other datatypes are rejected by fused_supported() before packing
+}
+
+void fused_unpack( const char* buffer, const array::SVector<int>& map, int begin, int end, array::Array& array ) {
+    if ( array.datatype() == array::DataType::kind<int>() ) {
+        fused_unpack<int>( buffer, map, begin, end, array );
+    }
+    else if ( array.datatype() == array::DataType::kind<long>() ) {
+        fused_unpack<long>( buffer, map, begin, end, array );
+    }
+    else if ( array.datatype() == array::DataType::kind<float>() ) {
+        fused_unpack<float>( buffer, map, begin, end, array );
+    }
+    else if ( array.datatype() == array::DataType::kind<double>() ) {
+        fused_unpack<double>( buffer, map, begin, end, array );
+    }
+    // other datatypes are rejected by fused_supported() before packing
+}
+
+/// Byte layout of a fused message buffer: for every partner task one contiguous segment,
+/// in which every array occupies an aligned block of (count * bytes_per_point) bytes
+struct FusedLayout {
+    FusedLayout( const std::vector<int>& counts, const std::vector<size_t>& bytes_per_point ) {
+        const size_t nproc   = counts.size();
+        const size_t nfields = bytes_per_point.size();
+        offsets.resize( nproc * nfields );
+        displs.resize( nproc );
+        sizes.resize( nproc );
+        size_t offset = 0;
+        for ( size_t jproc = 0; jproc < nproc; ++jproc ) {
+            offset        = fused_align( offset );
+            displs[jproc] = offset;
+            for ( size_t jfield = 0; jfield < nfields; ++jfield ) {
+                offset                            = fused_align( offset );
+                offsets[jproc * nfields + jfield] = offset;
+                offset += static_cast<size_t>( counts[jproc] ) * bytes_per_point[jfield];
+            }
+            sizes[jproc] = offset - displs[jproc];
+        }
+        total = fused_align( offset );
+    }
+    std::vector<size_t> offsets;
+    std::vector<size_t> displs;
+    std::vector<size_t> sizes;
+    size_t total;
+};
+
+}  // namespace
+
+void HaloExchange::execute( const std::vector<array::Array*>& arrays ) const {
+    ATLAS_TRACE( "HaloExchange (fused)", {"halo-exchange"} );
+    if ( !is_setup_ ) {
+        throw_Exception( "HaloExchange was not setup", Here() );
+    }
+    if ( persistent_.in_progress ) {
+        throw_Exception( "HaloExchange::execute: an exchange started with execute_begin is in progress", Here() );
+    }
+
+    const size_t nfields = arrays.size();
+    std::vector<size_t> bytes_per_point( nfields );
+    for ( size_t jfield = 0; jfield < nfields; ++jfield ) {
+        const array::Array& array = *arrays[jfield];
+        if ( array.rank() < 1 || array.rank() > 4 ) {
+            throw_NotImplemented( "Rank not supported in halo exchange", Here() );
+        }
+        // Validated here, as the packing below runs in a parallel region and must not throw
+        if ( not fused_supported( array ) || array.datatype().size() > fused_alignment ) {
+            throw_Exception( "datatype not supported", Here() );
+        }
+        ATLAS_ASSERT( array.shape( 0 ) >= parsize_ );
+        bytes_per_point[jfield] = fused_bytes_per_point( array );
+    }
+
+    FusedLayout send_layout( sendcounts_, bytes_per_point );
+    FusedLayout recv_layout( recvcounts_, bytes_per_point );
+
+    char* send_buffer = persistent_buffer<char>( persistent_.send_buffer, send_layout.total );
+    char* recv_buffer = persistent_buffer<char>( persistent_.recv_buffer, recv_layout.total );
+
+    const size_t nproc_loc( static_cast<size_t>( nproc ) );
+    std::vector<eckit::mpi::Request> send_req( nproc_loc ), recv_req( nproc_loc );
+
+    int tag( 1 );
+    ATLAS_TRACE_MPI( IRECEIVE, mpi::Volume::of<char>( recv_layout.sizes ) ) {
+        for ( size_t jproc = 0; jproc < nproc_loc; ++jproc ) {
+            if ( recvcounts_[jproc] > 0 ) {
+                recv_req[jproc] = mpi::comm().iReceive( recv_buffer + recv_layout.displs[jproc],
+                                                        recv_layout.sizes[jproc], jproc, tag );
+            }
+        }
+    }
+
+    ATLAS_TRACE_SCOPE( "pack" ) {
+        atlas_omp_parallel_for( size_t jfield = 0; jfield < nfields; ++jfield ) {
+            for ( size_t jproc = 0; jproc < nproc_loc; ++jproc ) {
+                if ( sendcounts_[jproc] > 0 ) {
+                    fused_pack( *arrays[jfield], sendmap_, senddispls_[jproc],
+                                senddispls_[jproc] + sendcounts_[jproc],
+                                send_buffer + send_layout.offsets[jproc * nfields + jfield] );
+                }
+            }
+        }
+    }
+
+    ATLAS_TRACE_MPI( ISEND, mpi::Volume::of<char>( send_layout.sizes ) ) {
+        for ( size_t jproc = 0; jproc < nproc_loc; ++jproc ) {
+            if ( sendcounts_[jproc] > 0 ) {
+                send_req[jproc] =
+                    mpi::comm().iSend( send_buffer + send_layout.displs[jproc], send_layout.sizes[jproc], jproc, tag );
+            }
+        }
+    }
+
+    wait_for_receive( recvcounts_, recv_req );
+
+    ATLAS_TRACE_SCOPE( "unpack" ) {
+        atlas_omp_parallel_for( size_t jfield = 0; jfield < nfields; ++jfield ) {
+            for ( size_t jproc = 0; jproc < nproc_loc; ++jproc ) {
+                if ( recvcounts_[jproc] > 0 ) {
+                    fused_unpack( recv_buffer + recv_layout.offsets[jproc * nfields + jfield], recvmap_,
+                                  recvdispls_[jproc], recvdispls_[jproc] + recvcounts_[jproc], *arrays[jfield] );
+                }
+            }
+        }
+    }
+
+    wait_for_send( sendcounts_, send_req );
+}
+
+void HaloExchange::wait_for_receive( const std::vector<int>& recv_counts_init,
+                                     std::vector<eckit::mpi::Request>& recv_req ) const {
+    ATLAS_TRACE_MPI( WAIT, "mpi-wait receive" ) {
+        for ( int jproc = 0; jproc < nproc; ++jproc ) {
+            if ( recv_counts_init[jproc] > 0 ) {
+                mpi::comm().wait( recv_req[jproc] );
+            }
+        }
+    }
+}
+
+void HaloExchange::wait_for_send( const std::vector<int>& send_counts_init,
                                   std::vector<eckit::mpi::Request>& send_req ) const {
     ATLAS_TRACE_MPI( WAIT, "mpi-wait send" ) {
         for ( int jproc = 0; jproc < nproc; ++jproc ) {
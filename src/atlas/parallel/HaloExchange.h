@@ -23,6 +23,7 @@
 #include "atlas/parallel/mpi/Statistics.h"
 #include "atlas/parallel/mpi/mpi.h"
 
+#include "atlas/array/Array.h"
 #include "atlas/array/ArrayView.h"
 #include "atlas/array/ArrayViewDefs.h"
 #include "atlas/array/ArrayViewUtil.h"
@@ -60,6 +61,34 @@ public:  // methods
     template <typename DATA_TYPE, int RANK, typename ParallelDim = array::FirstDim>
     void execute_adjoint( array::Array& field, bool on_device = false ) const;
 
+    /// @brief Start a non-blocking halo exchange (host memory only)
+    ///
+    /// Owned values are packed into persistent send buffers and all messages are posted.
+    /// Until the matching execute_end() the halo values of the field must not be accessed,
+    /// while owned values may be freely read and modified.
+    /// Only one split-phase exchange can be in progress per HaloExchange object, and all tasks
+    /// must begin exchanges with different HaloExchange objects in the same order.
+    template <typename DATA_TYPE, int RANK, typename ParallelDim = array::FirstDim>
+    void execute_begin( array::Array& field ) const;
+
+    /// @brief Complete a halo exchange started with execute_begin() on the same field
+    template <typename DATA_TYPE, int RANK, typename ParallelDim = array::FirstDim>
+    void execute_end( array::Array& field ) const;
+
+    /// @brief True between execute_begin() and execute_end()
+    bool in_progress() const { return persistent_.in_progress; }
+
+    /// @brief Release the persistent send and receive buffers
+    ///
+    /// The buffers keep the size of the largest exchange so far; they are allocated again by the next exchange.
+    void release_buffers() const;
+
+    /// @brief Exchange halos of several arrays at once, sending a single message per partner task
+    ///
+    /// Arrays may differ in rank (1 to 4) and data type (int, long, float, double), but must all
+    /// have the first dimension as parallel dimension. Host memory only.
+    void execute( const std::vector<array::Array*>& arrays ) const;
+
 private:  // methods
     idx_t index( idx_t i, idx_t j, idx_t k, idx_t ni, idx_t nj, idx_t /*nk*/ ) const {
         return ( i + ni * ( j + nj * k ) );
@@ -84,11 +113,25 @@ private:  // methods
                                      std::vector<int>& send_counts, std::vector<eckit::mpi::Request>& send_req,
                                      DATA_TYPE* send_buffer ) const;
 
-    void wait_for_send( std::vector<int>& send_counts, std::vector<eckit::mpi::Request>& send_req ) const;
+    template <typename DATA_TYPE>
+    void isend( int tag, std::vector<int>& send_displs, std::vector<int>& send_counts,
+                std::vector<eckit::mpi::Request>& send_req, DATA_TYPE* send_buffer ) const;
+
+    void wait_for_receive( const std::vector<int>& recv_counts_init, std::vector<eckit::mpi::Request>& recv_req ) const;
+
+    void wait_for_send( const std::vector<int>& send_counts, std::vector<eckit::mpi::Request>& send_req ) const;
 
     template <typename DATA_TYPE>
     DATA_TYPE* allocate_buffer( const int buffer_size, const bool on_device ) const;
 
+    template <typename DATA_TYPE>
+    DATA_TYPE* persistent_buffer( std::vector<char>& storage, const size_t buffer_size ) const;
+
+    void persistent_counts_displs_setup( const idx_t var_size ) const;
+
+    /// Complete the messages of the exchange in progress without unpacking them
+    void persistent_discard() const;
+
     template <typename DATA_TYPE>
     void deallocate_buffer( DATA_TYPE* buffer, const bool on_device ) const;
 
@@ -137,6 +180,26 @@ private:  // data
     int nproc;
     int myproc;
 
+    /// Buffers, counts and requests that are reused by execute_begin()/execute_end(),
+    /// so that repeated exchanges do not allocate nor recompute displacements.
+    /// As they are shared by all host exchanges, a HaloExchange object must not execute
+    /// exchanges concurrently from several threads.
+    struct Persistent {
+        std::vector<char> send_buffer;
+        std::vector<char> recv_buffer;
+        idx_t var_size{-1};
+        std::vector<int> send_counts_init;
+        std::vector<int> recv_counts_init;
+        std::vector<int> send_counts;
+        std::vector<int> recv_counts;
+        std::vector<int> send_displs;
+        std::vector<int> recv_displs;
+        std::vector<eckit::mpi::Request> send_req;
+        std::vector<eckit::mpi::Request> recv_req;
+        bool in_progress{false};
+    };
+    mutable Persistent persistent_;
+
 public:
     struct Backdoor {
         int parsize;
@@ -150,6 +213,19 @@ void HaloExchange::execute( array::Array& field, bool on_device ) const {
         throw_Exception( "HaloExchange was not setup", Here() );
     }
 
+    if ( persistent_.in_progress ) {
+        // The messages of this exchange would be matched with those of the exchange in progress
+        throw_Exception( "HaloExchange::execute called while an exchange started with execute_begin is in progress",
+                         Here() );
+    }
+
+    if ( !on_device ) {
+        // Blocking exchange using the persistent buffers
+        execute_begin<DATA_TYPE, RANK, ParallelDim>( field );
+        execute_end<DATA_TYPE, RANK, ParallelDim>( field );
+        return;
+    }
+
     auto field_hv = array::make_host_view<DATA_TYPE, RANK>( field );
     auto field_dv =
         on_device ? array::make_device_view<DATA_TYPE, RANK>( field ) : array::make_host_view<DATA_TYPE, RANK>( field );
@@ -189,6 +265,75 @@ void HaloExchange::execute( array::Array& field, bool on_device ) const {
     deallocate_buffer<DATA_TYPE>( halo_buffer, on_device );
 }
 
+template <typename DATA_TYPE, int RANK, typename ParallelDim>
+void HaloExchange::execute_begin( array::Array& field ) const {
+    ATLAS_TRACE( "HaloExchange::execute_begin", {"halo-exchange"} );
+    if ( !is_setup_ ) {
+        throw_Exception( "HaloExchange was not setup", Here() );
+    }
+    if ( persistent_.in_progress ) {
+        throw_Exception( "HaloExchange::execute_begin: previous exchange was not completed with execute_end", Here() );
+    }
+
+    auto field_hv = array::make_host_view<DATA_TYPE, RANK>( field );
+
+    constexpr int parallelDim = array::get_parallel_dim<ParallelDim>( field_hv );
+    idx_t var_size            = array::get_var_size<parallelDim>( field_hv );
+
+    int tag( 1 );
+    int inner_size          = sendcnt_ * var_size;
+    int halo_size           = recvcnt_ * var_size;
+    DATA_TYPE* inner_buffer = persistent_buffer<DATA_TYPE>( persistent_.send_buffer, inner_size );
+    DATA_TYPE* halo_buffer  = persistent_buffer<DATA_TYPE>( persistent_.recv_buffer, halo_size );
+
+    persistent_counts_displs_setup( var_size );
+
+    ireceive<DATA_TYPE>( tag, persistent_.recv_displs, persistent_.recv_counts, persistent_.recv_req, halo_buffer );
+
+    /// Pack
+    pack_send_buffer<parallelDim>( field_hv, field_hv, inner_buffer, inner_size, false );
+
+    isend<DATA_TYPE>( tag, persistent_.send_displs, persistent_.send_counts, persistent_.send_req, inner_buffer );
+
+    persistent_.in_progress = true;
+}
+
+template <typename DATA_TYPE, int RANK, typename ParallelDim>
+void HaloExchange::execute_end( array::Array& field ) const {
+    ATLAS_TRACE( "HaloExchange::execute_end", {"halo-exchange"} );
+    if ( !persistent_.in_progress ) {
+        throw_Exception( "HaloExchange::execute_end called without matching execute_begin", Here() );
+    }
+
+    // The field is validated before it is accessed. On error, the messages in flight are completed first,
+    // so that this object can still be used
+    if ( field.datatype() != array::DataType::kind<DATA_TYPE>() || field.rank() != RANK ) {
+        persistent_discard();
+        throw_Exception( "HaloExchange::execute_end called with a field that differs from execute_begin", Here() );
+    }
+
+    auto field_hv = array::make_host_view<DATA_TYPE, RANK>( field );
+
+    constexpr int parallelDim = array::get_parallel_dim<ParallelDim>( field_hv );
+    idx_t var_size            = array::get_var_size<parallelDim>( field_hv );
+    if ( var_size != persistent_.var_size ) {
+        persistent_discard();
+        throw_Exception( "HaloExchange::execute_end called with a field that differs from execute_begin", Here() );
+    }
+
+    int halo_size                = recvcnt_ * var_size;
+    const DATA_TYPE* halo_buffer = reinterpret_cast<const DATA_TYPE*>( persistent_.recv_buffer.data() );
+
+    wait_for_receive( persistent_.recv_counts_init, persistent_.recv_req );
+
+    /// Unpack
+    unpack_recv_buffer<parallelDim>( halo_buffer, halo_size, field_hv, field_hv, false );
+
+    wait_for_send( persistent_.send_counts_init, persistent_.send_req );
+
+    persistent_.in_progress = false;
+}
+
 template <typename DATA_TYPE, int RANK, typename ParallelDim>
 void HaloExchange::execute_adjoint( array::Array& field, bool on_device ) const {
     if ( !is_setup_ ) {
@@ -255,6 +400,17 @@ DATA_TYPE* HaloExchange::allocate_buffer( const int buffer_size, const bool on_d
 }
 
 
+template <typename DATA_TYPE>
+DATA_TYPE* HaloExchange::persistent_buffer( std::vector<char>& storage, const size_t buffer_size ) const {
+    // Storage only grows until release_buffers(); memory from operator new is suitably aligned for any fundamental type
+    const size_t bytes = buffer_size * sizeof( DATA_TYPE );
+    if ( storage.size() < bytes ) {
+        storage.resize( bytes );
+    }
+    return reinterpret_cast<DATA_TYPE*>( storage.data() );
+}
+
+
 template <typename DATA_TYPE>
 void HaloExchange::deallocate_buffer( DATA_TYPE* buffer, const bool on_device ) const {
     if ( on_device ) {
@@ -284,7 +440,7 @@ void HaloExchange::counts_displs_setup( const idx_t var_size, std::vector<int>&
 template <typename DATA_TYPE>
 void HaloExchange::ireceive( int tag, std::vector<int>& recv_displs, std::vector<int>& recv_counts,
                              std::vector<eckit::mpi::Request>& recv_req, DATA_TYPE* recv_buffer ) const {
-    ATLAS_TRACE_MPI( IRECEIVE ) {
+    ATLAS_TRACE_MPI( IRECEIVE, mpi::Volume::of<DATA_TYPE>( recv_counts ) ) {
         /// Let MPI know what we like to receive
         for ( size_t jproc = 0; jproc < static_cast<size_t>( nproc ); ++jproc ) {
             if ( recv_counts[jproc] > 0 ) {
@@ -302,19 +458,19 @@ void HaloExchange::isend_and_wait_for_receive( int tag, std::vector<int>& recv_c
                                                std::vector<eckit::mpi::Request>& send_req,
                                                DATA_TYPE* send_buffer ) const {
     /// Send
-    ATLAS_TRACE_MPI( ISEND ) {
-        for ( size_t jproc = 0; jproc < static_cast<size_t>( nproc ); ++jproc ) {
-            if ( send_counts[jproc] > 0 ) {
-                send_req[jproc] = mpi::comm().iSend( &send_buffer[send_displs[jproc]], send_counts[jproc], jproc, tag );
-            }
-        }
-    }
+    isend<DATA_TYPE>( tag, send_displs, send_counts, send_req, send_buffer );
 
     /// Wait for receiving to finish
-    ATLAS_TRACE_MPI( WAIT, "mpi-wait receive" ) {
+    wait_for_receive( recv_counts_init, recv_req );
+}
+
+template <typename DATA_TYPE>
+void HaloExchange::isend( int tag, std::vector<int>& send_displs, std::vector<int>& send_counts,
+                          std::vector<eckit::mpi::Request>& send_req, DATA_TYPE* send_buffer ) const {
+    ATLAS_TRACE_MPI( ISEND, mpi::Volume::of<DATA_TYPE>( send_counts ) ) {
         for ( size_t jproc = 0; jproc < static_cast<size_t>( nproc ); ++jproc ) {
-            if ( recv_counts_init[jproc] > 0 ) {
-                mpi::comm().wait( recv_req[jproc] );
+            if ( send_counts[jproc] > 0 ) {
+                send_req[jproc] = mpi::comm().iSend( &send_buffer[send_displs[jproc]], send_counts[jproc], jproc, tag );
             }
         }
     }
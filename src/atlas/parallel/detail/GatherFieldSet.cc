@@ -0,0 +1,73 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include "atlas/parallel/detail/GatherFieldSet.h"
+
+#include <vector>
+
+#include "atlas/array.h"
+#include "atlas/field/Field.h"
+#include "atlas/field/FieldSet.h"
+#include "atlas/parallel/GatherScatter.h"
+#include "atlas/runtime/Exception.h"
+
+namespace atlas {
+namespace parallel {
+namespace detail {
+
+namespace {
+
+template <typename T>
+void gather_fieldset( const GatherScatter& gather_scatter, const FieldSet& local_fieldset,
+                      FieldSet& global_fieldset ) {
+    // All fields of type T are gathered together, each on the task that owns its global field
+    std::vector<parallel::Field<T const>> loc_fields;
+    std::vector<parallel::Field<T>> glb_fields;
+    std::vector<idx_t> roots;
+    for ( idx_t f = 0; f < local_fieldset.size(); ++f ) {
+        const atlas::Field& loc = local_fieldset[f];
+        if ( loc.datatype() != array::DataType::kind<T>() ) {
+            continue;
+        }
+        atlas::Field& glb = global_fieldset[f];
+        idx_t root( 0 );
+        glb.metadata().get( "owner", root );
+        loc_fields.emplace_back( make_leveled_view<const T>( loc ) );
+        glb_fields.emplace_back( make_leveled_view<T>( glb ) );
+        roots.emplace_back( root );
+    }
+    if ( not roots.empty() ) {
+        gather_scatter.gather( loc_fields.data(), glb_fields.data(), static_cast<idx_t>( roots.size() ), roots );
+    }
+}
+
+}  // namespace
+
+void gather_fieldset( const GatherScatter& gather_scatter, const FieldSet& local_fieldset,
+                      FieldSet& global_fieldset ) {
+    ATLAS_ASSERT( local_fieldset.size() == global_fieldset.size() );
+
+    for ( idx_t f = 0; f < local_fieldset.size(); ++f ) {
+        const array::DataType datatype = local_fieldset[f].datatype();
+        if ( datatype != array::DataType::kind<int>() && datatype != array::DataType::kind<long>() &&
+             datatype != array::DataType::kind<float>() && datatype != array::DataType::kind<double>() ) {
+            throw_Exception( "datatype not supported", Here() );
+        }
+    }
+
+    gather_fieldset<int>( gather_scatter, local_fieldset, global_fieldset );
+    gather_fieldset<long>( gather_scatter, local_fieldset, global_fieldset );
+    gather_fieldset<float>( gather_scatter, local_fieldset, global_fieldset );
+    gather_fieldset<double>( gather_scatter, local_fieldset, global_fieldset );
+}
+
+}  // namespace detail
+}  // namespace parallel
+}  // namespace atlas
@@ -0,0 +1,58 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#pragma once
+
+#include "atlas/array.h"
+
+namespace atlas {
+class FieldSet;
+namespace parallel {
+class GatherScatter;
+}  // namespace parallel
+}  // namespace atlas
+
+namespace atlas {
+namespace parallel {
+namespace detail {
+
+/// @brief View of a field with dimensions ( points, levels, variables ), as used by GatherScatter and HaloExchange
+///
+/// Missing levels or variables dimensions are added as dummy dimensions of size 1.
+template <typename T, typename Field>
+array::LocalView<T, 3> make_leveled_view( Field& field ) {
+    using namespace array;
+    if ( field.levels() ) {
+        if ( field.variables() ) {
+            return make_view<T, 3>( field ).slice( Range::all(), Range::all(), Range::all() );
+        }
+        else {
+            return make_view<T, 2>( field ).slice( Range::all(), Range::all(), Range::dummy() );
+        }
+    }
+    else {
+        if ( field.variables() ) {
+            return make_view<T, 2>( field ).slice( Range::all(), Range::dummy(), Range::all() );
+        }
+        else {
+            return make_view<T, 1>( field ).slice( Range::all(), Range::dummy(), Range::dummy() );
+        }
+    }
+}
+
+/// @brief Gather all fields of local_fieldset into the matching fields of global_fieldset
+///
+/// Each global field is gathered on the task given by its "owner" metadata (default 0). All fields of the same
+/// datatype are gathered together in a single communication. Supported datatypes are int, long, float and double.
+void gather_fieldset( const GatherScatter&, const FieldSet& local_fieldset, FieldSet& global_fieldset );
+
+}  // namespace detail
+}  // namespace parallel
+}  // namespace atlas
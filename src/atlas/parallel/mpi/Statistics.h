@@ -62,6 +62,31 @@ static const std::string& name( Operation c ) {
     return names[static_cast<size_t>( c )];
 }
 
+/// @brief Number of messages and payload bytes that this task sends or receives in a traced MPI operation
+///
+/// Collective operations count as one message per call.
+/// Usage:
+///     ATLAS_TRACE_MPI( ISEND, mpi::Volume::of<double>( send_counts ) ) { ... }
+struct Volume {
+    Volume( size_t _messages, size_t _bytes ) : messages( _messages ), bytes( _bytes ) {}
+
+    /// @brief One message for every non-zero count, with counts given in number of values of type T
+    template <typename T, typename Counts>
+    static Volume of( const Counts& counts ) {
+        Volume volume( 0, 0 );
+        for ( const auto& count : counts ) {
+            if ( count > 0 ) {
+                volume.messages += 1;
+                volume.bytes += static_cast<size_t>( count ) * sizeof( T );
+            }
+        }
+        return volume;
+    }
+
+    size_t messages;
+    size_t bytes;
+};
+
 class Trace : public runtime::trace::TraceT<StatisticsTimerTraits> {
     using Base = runtime::trace::TraceT<StatisticsTimerTraits>;
 
@@ -69,6 +94,14 @@ public:
     Trace( const eckit::CodeLocation& loc, Operation c ) : Base( loc, name( c ), make_labels( c ) ) {}
     Trace( const eckit::CodeLocation& loc, Operation c, const std::string& title ) :
         Base( loc, title, make_labels( c ) ) {}
+    Trace( const eckit::CodeLocation& loc, Operation c, const Volume& volume ) :
+        Base( loc, name( c ), make_labels( c ) ) {
+        updateVolume( volume.messages, volume.bytes );
+    }
+    Trace( const eckit::CodeLocation& loc, Operation c, const std::string& title, const Volume& volume ) :
+        Base( loc, title, make_labels( c ) ) {
+        updateVolume( volume.messages, volume.bytes );
+    }
 
 private:
     static std::vector<std::string> make_labels( Operation c ) { return {"mpi", name( c )}; }
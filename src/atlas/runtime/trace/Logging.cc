@@ -26,7 +26,7 @@ namespace trace {
 //-----------------------------------------------------------------------------------------------------------
 
 bool Control::enabled() {
-    return atlas_omp_get_thread_num() == 0;
+    return true;
 }
 
 class LoggingState {
@@ -76,6 +76,9 @@ std::ostream& Logging::channel() {
 }
 
 bool Logging::enabled() {
+    if ( atlas_omp_get_thread_num() != 0 ) {
+        return false;  // Only the master thread prints within parallel regions
+    }
     return LoggingState::instance();
 }
 
@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include "atlas/parallel/omp/omp.h"
 #include "atlas/runtime/trace/CallStack.h"
 #include "atlas/runtime/trace/CodeLocation.h"
 #include "atlas/runtime/trace/Logging.h"
@@ -20,28 +21,60 @@ namespace atlas {
 namespace runtime {
 namespace trace {
 
+/// @class CurrentCallStack
+/// Call stack of the calling thread.
+/// Outside OpenMP parallel regions all traces share one call stack, which is modified in place. Within a parallel
+/// region, every thread starts from a copy of that call stack, taken at its first trace in the region, so that
+/// its traces nest within the enclosing traces without modifying the shared call stack.
 class CurrentCallStack {
 private:
     CurrentCallStack() {}
-    CallStack stack_;
+    CallStack stack_;  // Only used within parallel regions
+    size_t parallel_depth_{0};
+
+    static CallStack& serial_stack() {
+        static CallStack stack;
+        return stack;
+    }
 
 public:
     CurrentCallStack( CurrentCallStack const& ) = delete;
     CurrentCallStack& operator=( CurrentCallStack const& ) = delete;
     static CurrentCallStack& instance() {
-        static CurrentCallStack state;
+        static thread_local CurrentCallStack state;
         return state;
     }
-    operator CallStack() const { return stack_; }
+    operator CallStack() const { return parallel_depth_ ? stack_ : serial_stack(); }
     CallStack& push( const CodeLocation& loc, const std::string& id ) {
-        if ( Control::enabled() )
+        if ( Control::enabled() ) {
+            if ( atlas_omp_get_num_threads() > 1 ) {
+                if ( parallel_depth_ == 0 ) {
+                    stack_ = serial_stack();
+                }
+                ++parallel_depth_;
+            }
+            else {
+                serial_stack().push_front( loc, id );
+                return serial_stack();
+            }
             stack_.push_front( loc, id );
+        }
         return stack_;
     }
     void pop() {
-        if ( Control::enabled() )
-            stack_.pop_front();
+        if ( Control::enabled() ) {
+            if ( atlas_omp_get_num_threads() > 1 ) {
+                stack_.pop_front();
+                --parallel_depth_;
+            }
+            else {
+                serial_stack().pop_front();
+            }
+        }
     }
+
+    /// @brief Number of traces of the calling thread that are running within the current parallel region
+    size_t parallelDepth() const { return parallel_depth_; }
 };
 
 }  // namespace trace
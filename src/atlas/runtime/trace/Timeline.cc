@@ -0,0 +1,243 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include "Timeline.h"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+#include "eckit/config/Resource.h"
+
+#include "atlas/parallel/mpi/mpi.h"
+#include "atlas/parallel/omp/omp.h"
+#include "atlas/runtime/Exception.h"
+#include "atlas/runtime/trace/Nesting.h"
+
+//-----------------------------------------------------------------------------------------------------------
+
+namespace atlas {
+namespace runtime {
+namespace trace {
+
+namespace {
+
+struct Event {
+    Timings::Identifier id;
+    double begin;
+    double end;
+    int thread;
+};
+
+class TimelineRegistry {
+private:
+    TimelineRegistry() :
+        capacity_( std::max( 1l, eckit::Resource<long>( "$ATLAS_TRACE_TIMELINE_EVENTS", 1000000 ) ) ) {}
+
+public:
+    static TimelineRegistry& instance() {
+        static TimelineRegistry registry;
+        return registry;
+    }
+
+    void record( const std::vector<Event>& events ) {
+        std::lock_guard<std::mutex> guard( mutex_ );
+        for ( const auto& event : events ) {
+            if ( events_.size() < capacity_ ) {
+                events_.emplace_back( event );
+            }
+            else {
+                events_[next_ % capacity_] = event;
+            }
+            ++next_;
+        }
+    }
+
+    void clear() {
+        std::lock_guard<std::mutex> guard( mutex_ );
+        events_.clear();
+        next_ = 0;
+    }
+
+    /// Events from oldest to most recent
+    std::vector<Event> events() const {
+        std::lock_guard<std::mutex> guard( mutex_ );
+        std::vector<Event> ordered( events_.size() );
+        const size_t oldest = ( next_ > capacity_ ) ? next_ % capacity_ : 0;
+        std::rotate_copy( events_.begin(), events_.begin() + oldest, events_.end(), ordered.begin() );
+        return ordered;
+    }
+
+    size_t dropped() const {
+        std::lock_guard<std::mutex> guard( mutex_ );
+        return next_ - events_.size();
+    }
+
+    bool enabled{false};
+
+private:
+    const size_t capacity_;
+    std::vector<Event> events_;
+    size_t next_{0};
+    mutable std::mutex mutex_;
+};
+
+std::string json_escape( const std::string& in ) {
+    std::string out;
+    out.reserve( in.size() );
+    for ( char c : in ) {
+        switch ( c ) {
+            case '"':
+                out += "\\\"";
+                break;
+            case '\\':
+                out += "\\\\";
+                break;
+            case '\n':
+                out += "\\n";
+                break;
+            case '\t':
+                out += "\\t";
+                break;
+            default:
+                if ( static_cast<unsigned char>( c ) < 0x20 ) {
+                    out += ' ';
+                }
+                else {
+                    out += c;
+                }
+        }
+    }
+    return out;
+}
+
+}  // namespace
+
+//-----------------------------------------------------------------------------------------------------------
+
+void Timeline::enable( bool value ) {
+    TimelineRegistry::instance().enabled = value;
+}
+
+bool Timeline::enabled() {
+    return TimelineRegistry::instance().enabled;
+}
+
+double Timeline::now() {
+    using namespace std::chrono;
+    return duration<double, std::micro>( system_clock::now().time_since_epoch() ).count();
+}
+
+void Timeline::record( const Identifier& id, double begin, double end ) {
+    // Events are buffered per thread, and merged into the registry when the outermost trace of this thread
+    // within a parallel region ends, so that traces in parallel loops do not contend for the registry
+    static thread_local std::vector<Event> events;
+    events.emplace_back( Event{id, begin, end, atlas_omp_get_thread_num()} );
+    if ( atlas_omp_get_num_threads() == 1 || CurrentCallStack::instance().parallelDepth() == 0 ) {
+        TimelineRegistry::instance().record( events );
+        events.clear();
+    }
+}
+
+void Timeline::clear() {
+    TimelineRegistry::instance().clear();
+}
+
+void Timeline::write( const std::string& path ) {
+    const auto& registry = TimelineRegistry::instance();
+    const int root       = 0;
+    const int rank       = static_cast<int>( mpi::rank() );
+    const auto events    = registry.events();
+
+    // Timestamps are made relative to the first event of all tasks
+    double local_begin = events.empty() ? std::numeric_limits<double>::max() : events.front().begin;
+    for ( const auto& event : events ) {
+        local_begin = std::min( local_begin, event.begin );
+    }
+    double begin;
+    mpi::comm().allReduce( local_begin, begin, eckit::mpi::min() );
+
+    std::ostringstream out;
+    out << std::fixed << std::setprecision( 3 );
+    out << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << rank << ",\"args\":{\"name\":\"task " << rank
+        << "\"}},\n";
+    out << "{\"name\":\"process_sort_index\",\"ph\":\"M\",\"pid\":" << rank << ",\"args\":{\"sort_index\":" << rank
+        << "}}";
+    for ( const auto& event : events ) {
+        out << ",\n{\"name\":\"" << json_escape( Timings::title( event.id ) ) << "\",\"ph\":\"X\",\"ts\":"
+            << event.begin - begin << ",\"dur\":" << event.end - event.begin << ",\"pid\":" << rank
+            << ",\"tid\":" << event.thread << "}";
+    }
+    const std::string local = out.str();
+    const long dropped      = static_cast<long>( registry.dropped() );
+
+    std::vector<long> dropped_per_task( mpi::size() );
+    mpi::comm().gather( dropped, dropped_per_task, root );
+
+    // Every task sends its events to the root in turn, in bounded messages that are written right away,
+    // so that the root never holds more than the events of one task
+    const size_t max_message_size = size_t( 64 ) << 20;
+    const int tag                 = 0;
+
+    std::ofstream file;
+    int opened = 1;
+    if ( rank == root ) {
+        file.open( path );
+        opened = file.is_open() ? 1 : 0;
+    }
+    mpi::comm().broadcast( opened, root );
+    if ( not opened ) {
+        throw_CantOpenFile( path, Here() );
+    }
+
+    if ( rank == root ) {
+        file << "{\"displayTimeUnit\":\"ms\",\n\"otherData\":{\"dropped_events\":[";
+        for ( size_t jproc = 0; jproc < dropped_per_task.size(); ++jproc ) {
+            file << ( jproc ? "," : "" ) << dropped_per_task[jproc];
+        }
+        file << "]},\n\"traceEvents\":[\n";
+        file << local;
+        std::vector<char> recv;
+        for ( int jproc = 0; jproc < static_cast<int>( mpi::size() ); ++jproc ) {
+            if ( jproc == root ) {
+                continue;
+            }
+            unsigned long size;
+            mpi::comm().receive( &size, 1, jproc, tag );
+            recv.resize( std::min<size_t>( size, max_message_size ) );
+            file << ",\n";
+            for ( size_t offset = 0; offset < size; offset += recv.size() ) {
+                const size_t count = std::min<size_t>( size - offset, recv.size() );
+                mpi::comm().receive( recv.data(), count, jproc, tag );
+                file.write( recv.data(), count );
+            }
+        }
+        file << "\n]}\n";
+    }
+    else {
+        const unsigned long size = local.size();
+        mpi::comm().send( &size, 1, root, tag );
+        for ( size_t offset = 0; offset < size; offset += max_message_size ) {
+            const size_t count = std::min<size_t>( size - offset, max_message_size );
+            mpi::comm().send( local.data() + offset, count, root, tag );
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------------------------------------
+
+}  // namespace trace
+}  // namespace runtime
+}  // namespace atlas
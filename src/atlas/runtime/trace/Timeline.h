@@ -0,0 +1,59 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#pragma once
+
+#include <iosfwd>
+#include <string>
+
+#include "atlas/runtime/trace/Timings.h"
+
+//-----------------------------------------------------------------------------------------------------------
+
+namespace atlas {
+namespace runtime {
+namespace trace {
+
+/// @brief Timeline of the begin and end times of every trace, per task and per thread
+///
+/// While enabled, every trace that stops records an event in a ring buffer of bounded size, so that only the
+/// most recent events are kept in long runs. The size of the buffer is given by environment variable
+/// ATLAS_TRACE_TIMELINE_EVENTS (default 1000000 events per task).
+/// The events of all tasks are written in the Chrome trace JSON format, which can be viewed with
+/// chrome://tracing or https://ui.perfetto.dev
+///
+/// The timeline is enabled and written in atlas::finalise() with environment variable
+/// ATLAS_TRACE_TIMELINE=<path>, or the "trace.timeline" configuration of atlas::initialise().
+class Timeline {
+public:
+    using Identifier = Timings::Identifier;
+
+public:  // static methods
+    static void enable( bool );
+
+    static bool enabled();
+
+    /// @brief Current time in microseconds
+    static double now();
+
+    /// @brief Record an event for the timer with given identifier, on the calling thread
+    static void record( const Identifier&, double begin, double end );
+
+    /// @brief Discard all recorded events
+    static void clear();
+
+    /// @brief Write the events of all tasks in Chrome trace JSON format on the first task, one task at a time
+    /// @note Collective operation
+    static void write( const std::string& path );
+};
+
+}  // namespace trace
+}  // namespace runtime
+}  // namespace atlas
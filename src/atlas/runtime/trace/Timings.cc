@@ -11,21 +11,28 @@
 
 #include "Timings.h"
 
+#include <algorithm>
+#include <array>
 #include <cmath>
 #include <iomanip>
 #include <limits>
+#include <mutex>
+#include <numeric>
 #include <regex>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 
 #include "eckit/config/Configuration.h"
 #include "eckit/filesystem/PathName.h"
 
 #include "atlas/parallel/mpi/mpi.h"
+#include "atlas/parallel/omp/omp.h"
 #include "atlas/runtime/Exception.h"
 #include "atlas/runtime/Log.h"
 #include "atlas/runtime/trace/CallStack.h"
 #include "atlas/runtime/trace/CodeLocation.h"
+#include "atlas/runtime/trace/Nesting.h"
 #include "atlas/util/Config.h"
 
 //-----------------------------------------------------------------------------------------------------------
@@ -35,12 +42,24 @@ namespace runtime {
 namespace trace {
 
 class TimingsRegistry {
+public:
+    using Samples = std::vector<std::pair<size_t, double>>;
+
+    /// Time accumulated by one thread within parallel regions, and number of samples it contributed
+    struct ThreadTiming {
+        double seconds{0.};
+        long count{0};
+    };
+
 private:
     std::vector<long> counts_;
     std::vector<double> tot_timings_;
     std::vector<double> min_timings_;
     std::vector<double> max_timings_;
     std::vector<double> var_timings_;
+    std::vector<size_t> messages_;
+    std::vector<size_t> bytes_;
+    std::vector<std::vector<ThreadTiming>> thread_timings_;  // Accumulated per thread within parallel regions
     std::vector<std::string> titles_;
     std::vector<CodeLocation> locations_;
     std::vector<long> nest_;
@@ -49,6 +68,8 @@ private:
 
     std::map<std::string, std::vector<size_t>> labels_;
 
+    std::mutex mutex_;
+
     TimingsRegistry() = default;
 
 public:
@@ -61,11 +82,20 @@ public:
 
     void update( size_t idx, double seconds );
 
+    /// Merge the samples recorded by a thread within a parallel region
+    void update( const Samples&, int thread );
+
+    void updateVolume( size_t idx, size_t messages, size_t bytes );
+
     size_t size() const;
 
+    const std::string& title( size_t idx ) const { return titles_[idx]; }
+
     void report( std::ostream& out, const eckit::Configuration& config );
 
 private:
+    void update_unlocked( size_t idx, double seconds );
+
     std::string filter_filepath( const std::string& filepath ) const;
 
     friend class Tree;
@@ -145,6 +175,7 @@ struct Tree {
 
 size_t TimingsRegistry::add( const CodeLocation& loc, const CallStack& stack, const std::string& title,
                              const Timings::Labels& labels ) {
+    std::lock_guard<std::mutex> guard( mutex_ );
     size_t key = stack.hash();
     auto it    = index_.find( key );
     if ( it == index_.end() ) {
@@ -155,6 +186,9 @@ size_t TimingsRegistry::add( const CodeLocation& loc, const CallStack& stack, co
         min_timings_.emplace_back( std::numeric_limits<double>::max() );
         max_timings_.emplace_back( 0 );
         var_timings_.emplace_back( 0 );
+        messages_.emplace_back( 0 );
+        bytes_.emplace_back( 0 );
+        thread_timings_.emplace_back();
         titles_.emplace_back( title );
         locations_.emplace_back( loc );
         nest_.emplace_back( stack.size() );
@@ -172,6 +206,11 @@ size_t TimingsRegistry::add( const CodeLocation& loc, const CallStack& stack, co
 }
 
 void TimingsRegistry::update( size_t idx, double seconds ) {
+    std::lock_guard<std::mutex> guard( mutex_ );
+    update_unlocked( idx, seconds );
+}
+
+void TimingsRegistry::update_unlocked( size_t idx, double seconds ) {
     auto sqr          = []( double x ) { return x * x; };
     double n          = counts_[idx] + 1;
     double avg_nm1    = tot_timings_[idx] / std::max( n, 1. );
@@ -183,6 +222,27 @@ void TimingsRegistry::update( size_t idx, double seconds ) {
     counts_[idx] += 1;
 }
 
+void TimingsRegistry::update( const Samples& samples, int thread ) {
+    std::lock_guard<std::mutex> guard( mutex_ );
+    for ( const auto& sample : samples ) {
+        const size_t idx = sample.first;
+        update_unlocked( idx, sample.second );
+        auto& thread_timings = thread_timings_[idx];
+        if ( thread_timings.size() <= size_t( thread ) ) {
+            thread_timings.resize( thread + 1 );
+        }
+        thread_timings[thread].seconds += sample.second;
+        thread_timings[thread].count += 1;
+    }
+}
+
+void TimingsRegistry::updateVolume( size_t idx, size_t messages, size_t bytes ) {
+    // Rare compared to timings (only MPI traces record volumes), so a lock suffices within parallel regions
+    std::lock_guard<std::mutex> guard( mutex_ );
+    messages_[idx] += messages;
+    bytes_[idx] += bytes;
+}
+
 size_t TimingsRegistry::size() const {
     return counts_.size();
 }
@@ -424,25 +484,114 @@ void TimingsRegistry::report( std::ostream& out, const eckit::Configuration& con
 
     out << print_horizontal( sepf ) << std::endl;
 
-    std::string sepc = box_horizontal( 3 );
+    // Timers that ran on several threads within parallel regions: spread of the time accumulated per thread,
+    // over the threads that actually ran the timer
+    auto thread_seconds = [&]( size_t j ) {
+        std::vector<double> seconds;
+        for ( const auto& thread_timing : thread_timings_[j] ) {
+            if ( thread_timing.count > 0 ) {
+                seconds.emplace_back( thread_timing.seconds );
+            }
+        }
+        return seconds;
+    };
+    std::vector<size_t> threaded;
+    size_t max_threaded_title_length = std::string( "Timers in parallel regions" ).size();
+    for ( size_t jj = 0; jj < size(); ++jj ) {
+        size_t j = order[jj];
+        if ( not excluded( j ) && thread_seconds( j ).size() > 1 ) {
+            threaded.emplace_back( j );
+            max_threaded_title_length = std::max( max_threaded_title_length, titles_[j].size() );
+        }
+    }
+    if ( not threaded.empty() ) {
+        const size_t time_width = max_digits_before_decimal + decimals + 2;
+        auto print_threaded_horizontal = [&]( const std::string& sep ) -> std::string {
+            std::stringstream ss;
+            ss << box_horizontal( max_threaded_title_length + digits( size() ) + 3 ) << sep << box_horizontal( 7 )
+               << sep << box_horizontal( time_width ) << sep << box_horizontal( time_width ) << sep
+               << box_horizontal( 7 );
+            return ss.str();
+        };
+        out << print_threaded_horizontal( sept ) << std::endl;
+        out << std::left << std::setw( max_threaded_title_length + digits( size() ) + 3 )
+            << "Timers in parallel regions" << sep << std::setw( 7 ) << "threads" << sep << std::setw( time_width )
+            << "min" << sep << std::setw( time_width ) << "max" << sep << "max/avg" << std::endl;
+        out << print_threaded_horizontal( seph ) << std::endl;
+        for ( size_t j : threaded ) {
+            const auto thread_timings = thread_seconds( j );
+            double min                 = *std::min_element( thread_timings.begin(), thread_timings.end() );
+            double max                 = *std::max_element( thread_timings.begin(), thread_timings.end() );
+            double avg = std::accumulate( thread_timings.begin(), thread_timings.end(), 0. ) / thread_timings.size();
+            std::stringstream imbalance;
+            imbalance << std::fixed << std::setprecision( 2 ) << ( avg > 0. ? max / avg : 1. );
+            out << std::setw( digits( long( size() ) ) ) << j << " : " << std::left
+                << std::setw( max_threaded_title_length ) << titles_[j] << sep << std::setw( 7 )
+                << thread_timings.size() << sep << print_time( min ) << sep << print_time( max ) << sep
+                << imbalance.str() << std::endl;
+        }
+        out << print_threaded_horizontal( sepf ) << std::endl;
+    }
 
-    out << std::left << box_horizontal( 40 ) << sept << box_horizontal( 5 ) << sept << box_horizontal( 12 ) << "\n";
+    auto print_bytes = []( double bytes ) -> std::string {
+        static const std::array<std::string, 5> units{"B", "KiB", "MiB", "GiB", "TiB"};
+        size_t unit = 0;
+        while ( bytes >= 1024. && unit + 1 < units.size() ) {
+            bytes /= 1024.;
+            ++unit;
+        }
+        std::stringstream out;
+        out << std::fixed << std::setprecision( unit == 0 ? 0 : 2 ) << bytes << " " << units[unit];
+        return out.str();
+    };
+
+    // Communication volumes are only recorded by some timers, e.g. those of MPI operations
+    bool volumes = false;
+    for ( auto label : labels_ ) {
+        for ( size_t j : label.second ) {
+            volumes = volumes or messages_[j] > 0;
+        }
+    }
+
+    auto print_label_horizontal = [&]( const std::string& sep ) -> std::string {
+        std::stringstream ss;
+        ss << box_horizontal( 40 ) << sep << box_horizontal( 5 ) << sep << box_horizontal( 12 );
+        if ( volumes ) {
+            ss << sep << box_horizontal( 10 ) << sep << box_horizontal( 12 ) << sep << box_horizontal( 14 );
+        }
+        return ss.str();
+    };
+
+    out << std::left << print_label_horizontal( sept ) << "\n";
     out << std::left << std::setw( 40 ) << "Timers accumulated by label" << sep << std::left << std::setw( 5 )
-        << "count" << sep << "time" << std::endl;
-    out << std::left << box_horizontal( 40 ) << seph << box_horizontal( 5 ) << seph << box_horizontal( 12 ) << "\n";
+        << "count" << sep << std::setw( 12 ) << "time";
+    if ( volumes ) {
+        out << sep << std::setw( 10 ) << "messages" << sep << std::setw( 12 ) << "bytes" << sep << "bandwidth";
+    }
+    out << std::endl;
+    out << std::left << print_label_horizontal( seph ) << "\n";
     for ( auto label : labels_ ) {
         auto name   = label.first;
         auto timers = label.second;
         double tot( 0 );
         double count( 0 );
+        size_t messages( 0 );
+        size_t bytes( 0 );
         for ( size_t j : timers ) {
             tot += tot_timings_[j];
             count += counts_[j];
+            messages += messages_[j];
+            bytes += bytes_[j];
         }
         out << std::left << std::setw( 40 ) << name << sep << std::left << std::setw( 5 ) << count << sep
-            << print_time( tot ) << std::endl;
+            << std::setw( 12 ) << print_time( tot );
+        if ( volumes and messages > 0 ) {
+            out << sep << std::setw( 10 ) << messages << sep << std::setw( 12 ) << print_bytes( bytes ) << sep
+                << ( tot > 0. ? print_bytes( bytes / tot ) + "/s" : "" );
+        }
+        out << std::endl;
     }
-    out << std::left << box_horizontal( 40 ) << sepf << box_horizontal( 5 ) << sepf << box_horizontal( 12 ) << "\n";
+    out << std::left << print_label_horizontal( sepf ) << "\n";
 }
 
 std::string TimingsRegistry::filter_filepath( const std::string& filepath ) const {
@@ -462,13 +611,41 @@ std::string TimingsRegistry::filter_filepath( const std::string& filepath ) cons
 
 Timings::Identifier Timings::add( const CodeLocation& loc, const CallStack& stack, const std::string& title,
                                   const Labels& labels ) {
-    return TimingsRegistry::instance().add( loc, stack, title, labels );
+    // Identifiers are cached per thread, so that the registry is only locked when a timer is first registered
+    static thread_local std::unordered_map<size_t, Identifier> identifiers;
+    const size_t key = stack.hash();
+    auto it          = identifiers.find( key );
+    if ( it != identifiers.end() ) {
+        return it->second;
+    }
+    const Identifier id = TimingsRegistry::instance().add( loc, stack, title, labels );
+    identifiers.emplace( key, id );
+    return id;
 }
 
 void Timings::update( const Identifier& id, double seconds ) {
+    if ( atlas_omp_get_num_threads() > 1 ) {
+        // Accumulate thread-local, and merge into the registry when the outermost trace of this thread
+        // within the parallel region ends, to avoid concurrent updates of the registry
+        static thread_local TimingsRegistry::Samples samples;
+        samples.emplace_back( id, seconds );
+        if ( CurrentCallStack::instance().parallelDepth() == 0 ) {
+            TimingsRegistry::instance().update( samples, atlas_omp_get_thread_num() );
+            samples.clear();
+        }
+        return;
+    }
     TimingsRegistry::instance().update( id, seconds );
 }
 
+void Timings::updateVolume( const Identifier& id, size_t messages, size_t bytes ) {
+    TimingsRegistry::instance().updateVolume( id, messages, bytes );
+}
+
+std::string Timings::title( const Identifier& id ) {
+    return TimingsRegistry::instance().title( id );
+}
+
 std::string Timings::report() {
     return report( util::NoConfig() );
 }
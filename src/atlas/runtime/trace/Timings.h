@@ -40,6 +40,11 @@ public:  // static methods
 
     static void update( const Identifier& id, double seconds );
 
+    /// @brief Accumulate the number of messages and bytes communicated by a timer
+    static void updateVolume( const Identifier& id, size_t messages, size_t bytes );
+
+    static std::string title( const Identifier& );
+
     static std::string report();
 
     static std::string report( const Configuration& );
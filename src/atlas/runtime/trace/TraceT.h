@@ -19,6 +19,7 @@
 #include "atlas/runtime/trace/CodeLocation.h"
 #include "atlas/runtime/trace/Nesting.h"
 #include "atlas/runtime/trace/StopWatch.h"
+#include "atlas/runtime/trace/Timeline.h"
 #include "atlas/runtime/trace/Timings.h"
 
 //-----------------------------------------------------------------------------------------------------------
@@ -66,6 +67,10 @@ public:
 
     double elapsed() const;
 
+protected:
+    /// @brief Accumulate the number of messages and bytes communicated within this trace
+    void updateVolume( size_t messages, size_t bytes ) const;
+
 private:  // types
     using Identifier = Timings::Identifier;
 
@@ -86,6 +91,7 @@ private:  // member data
     Identifier id_;
     CallStack callstack_;
     Labels labels_;
+    double timeline_begin_{0};
 };
 
 //-----------------------------------------------------------------------------------------------------------
@@ -128,10 +134,9 @@ inline void TraceT<TraceTraits>::barrier() const {
 
 template <typename TraceTraits>
 inline void TraceT<TraceTraits>::registerTimer() {
-    std::string title =
-        title_ + ( Barriers::state() ? " [b]" : "" ) +
-        ( atlas_omp_get_num_threads() > 1 ? " @thread[" + std::to_string( atlas_omp_get_thread_num() ) + "]" : "" );
-    id_ = Timings::add( loc_, callstack_, title, labels_ );
+    // Timers of all threads in a parallel region are merged; the report shows their load imbalance
+    std::string title = title_ + ( Barriers::state() ? " [b]" : "" );
+    id_               = Timings::add( loc_, callstack_, title, labels_ );
 }
 
 template <typename TraceTraits>
@@ -139,6 +144,13 @@ inline void TraceT<TraceTraits>::updateTimings() const {
     Timings::update( id_, stopwatch_.elapsed() );
 }
 
+template <typename TraceTraits>
+inline void TraceT<TraceTraits>::updateVolume( size_t messages, size_t bytes ) const {
+    if ( running_ ) {
+        Timings::updateVolume( id_, messages, bytes );
+    }
+}
+
 template <typename TraceTraits>
 inline bool TraceT<TraceTraits>::running() const {
     return running_;
@@ -154,6 +166,9 @@ inline void TraceT<TraceTraits>::start() {
         registerTimer();
         Tracing::start( title_ );
         barrier();
+        if ( Timeline::enabled() ) {
+            timeline_begin_ = Timeline::now();
+        }
         stopwatch_.start();
     }
 }
@@ -163,7 +178,11 @@ inline void TraceT<TraceTraits>::stop() {
     if ( running_ ) {
         barrier();
         stopwatch_.stop();
+        const double timeline_end = Timeline::enabled() ? Timeline::now() : 0.;
         CurrentCallStack::instance().pop();
+        if ( Timeline::enabled() ) {
+            Timeline::record( id_, timeline_begin_, timeline_end );
+        }
         updateTimings();
         Tracing::stop( title_, stopwatch_.elapsed() );
         running_ = false;
@@ -9,7 +9,14 @@
  */
 
 #include "atlas/trans/Cache.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cerrno>
 #include <cstdlib>
+#include <cstring>
 
 #include "eckit/io/DataHandle.h"
 
@@ -30,6 +37,39 @@ TransCacheFileEntry::TransCacheFileEntry( const eckit::PathName& path ) : buffer
     dh->close();
 }
 
+TransCacheMappedFileEntry::TransCacheMappedFileEntry( const eckit::PathName& path ) {
+    ATLAS_TRACE();
+    Log::debug() << "Mapping cache from file " << path << std::endl;
+    int fd = ::open( path.localPath(), O_RDONLY );
+    if ( fd < 0 ) {
+        throw_Exception( "Could not open cache file " + path.asString() + ": " + std::strerror( errno ), Here() );
+    }
+    struct stat st;
+    if ( ::fstat( fd, &st ) != 0 ) {
+        int err = errno;
+        ::close( fd );
+        throw_Exception( "Could not stat cache file " + path.asString() + ": " + std::strerror( err ), Here() );
+    }
+    size_ = static_cast<size_t>( st.st_size );
+    if ( size_ ) {
+        void* address = ::mmap( nullptr, size_, PROT_READ, MAP_SHARED, fd, 0 );
+        if ( address == MAP_FAILED ) {
+            int err = errno;
+            ::close( fd );
+            throw_Exception( "Could not map cache file " + path.asString() + ": " + std::strerror( err ), Here() );
+        }
+        data_ = address;
+    }
+    // The mapping remains valid after closing the file descriptor
+    ::close( fd );
+}
+
+TransCacheMappedFileEntry::~TransCacheMappedFileEntry() {
+    if ( data_ ) {
+        ::munmap( data_, size_ );
+    }
+}
+
 TransCacheMemoryEntry::TransCacheMemoryEntry( const void* data, size_t size ) : data_( data ), size_( size ) {
     ATLAS_ASSERT( data_ );
     ATLAS_ASSERT( size_ );
@@ -41,11 +81,11 @@ LegendreFFTCache::LegendreFFTCache( const void* legendre_address, size_t legendr
            std::make_shared<TransCacheMemoryEntry>( fft_address, fft_size ) ) {}
 
 LegendreFFTCache::LegendreFFTCache( const eckit::PathName& legendre_path, const eckit::PathName& fft_path ) :
-    Cache( std::shared_ptr<TransCacheEntry>( new TransCacheFileEntry( legendre_path ) ),
+    Cache( std::shared_ptr<TransCacheEntry>( new TransCacheMappedFileEntry( legendre_path ) ),
            std::shared_ptr<TransCacheEntry>( new TransCacheFileEntry( fft_path ) ) ) {}
 
 LegendreCache::LegendreCache( const eckit::PathName& path ) :
-    Cache( std::shared_ptr<TransCacheEntry>( new TransCacheFileEntry( path ) ) ) {}
+    Cache( std::shared_ptr<TransCacheEntry>( new TransCacheMappedFileEntry( path ) ) ) {}
 
 LegendreCache::LegendreCache( size_t size ) : Cache( std::make_shared<TransCacheOwnedMemoryEntry>( size ) ) {}
 
@@ -68,6 +68,24 @@ public:
 
 //-----------------------------------------------------------------------------
 
+/// @brief Cache entry that maps a file read-only in memory
+///
+/// Pages are shared via the operating system page cache between all processes that map the same file,
+/// so that tasks on the same node do not each hold a private copy of the cache.
+class TransCacheMappedFileEntry final : public TransCacheEntry {
+private:
+    void* data_  = nullptr;
+    size_t size_ = 0;
+
+public:
+    TransCacheMappedFileEntry( const eckit::PathName& path );
+    virtual ~TransCacheMappedFileEntry() override;
+    virtual size_t size() const override { return size_; }
+    virtual const void* data() const override { return data_; }
+};
+
+//-----------------------------------------------------------------------------
+
 class TransCacheMemoryEntry final : public TransCacheEntry {
 public:
     TransCacheMemoryEntry( const void* data, size_t size );
@@ -9,11 +9,14 @@
  * does it submit to any jurisdiction.
  */
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
+#include <vector>
 
 #include "atlas/array.h"
 #include "atlas/parallel/mpi/mpi.h"
+#include "atlas/parallel/omp/omp.h"
 #include "atlas/trans/local/LegendrePolynomials.h"
 
 namespace atlas {
@@ -45,111 +48,165 @@ void compute_zfn( const int trc, double zfn[] ) {
 }
 
 
-void compute_legendre_polynomials_lat( const int trc,     // truncation (in)
-                                       const double lat,  // latitude in radians (in)
-                                       double legpol[],   // legendre polynomials
-                                       double zfn[] ) {
-    auto idxmn  = [&]( int jm, int jn ) { return ( 2 * trc + 3 - jm ) * jm / 2 + jn - jm; };
+namespace {
+
+// Number of latitudes computed together, so that the recurrences vectorise across latitudes
+constexpr size_t lat_block = 8;
+
+size_t workspace_size( const int trc, const size_t nb ) {
+    return ( 5 + 2 * size_t( trc + 1 ) ) * nb;
+}
+
+// Compute Legendre polynomials for nb latitudes at once.
+// Storage is legpol[idxmn(jm,jn)*nb + jb] for latitude lat[jb], which for nb == 1 is the layout of a single latitude.
+// Coefficients that depend only on (jm,jn) are computed once for all latitudes of the block.
+// Scratch space work[] must hold workspace_size(trc,nb) values, so that no allocation happens per call.
+void compute_legendre_polynomials_lat_block( const int trc,       // truncation (in)
+                                             const size_t nb,     // number of latitudes in block (in)
+                                             const double lat[],  // latitudes in radians (in)
+                                             double legpol[],     // legendre polynomials (out)
+                                             const double zfn[],  // (in)
+                                             double work[] ) {    // scratch space (in/out)
+    auto idxmn  = [&]( int jm, int jn ) { return size_t( ( 2 * trc + 3 - jm ) * jm / 2 + jn - jm ) * nb; };
     auto idxzfn = [&]( int jn, int jk ) { return jk + ( trc + 1 ) * jn; };
-    {  //ATLAS_TRACE( "compute Legendre polynomials" );
-        // --------------------
-        // 1. First two columns
-        // --------------------
-        double zdlx1            = ( M_PI_2 - lat );               // theta
-        double zdlx             = std::cos( zdlx1 );              // cos(theta)
-        volatile double zdlsita = std::sqrt( 1. - zdlx * zdlx );  // sin(theta) (this is how trans library does it)
-
-        legpol[idxmn( 0, 0 )] = 1.;
-        double vsin[trc + 1], vcos[trc + 1];
+
+    double* zdlx     = work;
+    double* zdlsita  = zdlx + nb;
+    double* zdl1sita = zdlsita + nb;
+    double* zdlk     = zdl1sita + nb;
+    double* zdlldn   = zdlk + nb;
+    double* vsin     = zdlldn + nb;
+    double* vcos     = vsin + ( trc + 1 ) * nb;
+
+    // --------------------
+    // 1. First two columns
+    // --------------------
+    for ( size_t jb = 0; jb < nb; ++jb ) {
+        double zdlx1               = ( M_PI_2 - lat[jb] );                   // theta
+        zdlx[jb]                   = std::cos( zdlx1 );                      // cos(theta)
+        volatile double zdlsita_jb = std::sqrt( 1. - zdlx[jb] * zdlx[jb] );  // sin(theta) (as in trans library)
+        zdlsita[jb]                = zdlsita_jb;
+
+        legpol[idxmn( 0, 0 ) + jb] = 1.;
         for ( int j = 1; j <= trc; j++ ) {
-            vsin[j] = std::sin( j * zdlx1 );
+            vsin[j * nb + jb] = std::sin( j * zdlx1 );
         }
         for ( int j = 1; j <= trc; j++ ) {
-            vcos[j] = std::cos( j * zdlx1 );
+            vcos[j * nb + jb] = std::cos( j * zdlx1 );
         }
 
-        double zdl1sita = 0.;
+        zdl1sita[jb] = 0.;
         // if we are less than 1 meter from the pole,
-        if ( std::abs( zdlsita ) <= std::sqrt( std::numeric_limits<double>::epsilon() ) ) {
-            zdlx    = 1.;
-            zdlsita = 0.;
+        if ( std::abs( zdlsita[jb] ) <= std::sqrt( std::numeric_limits<double>::epsilon() ) ) {
+            zdlx[jb]    = 1.;
+            zdlsita[jb] = 0.;
         }
         else {
-            zdl1sita = 1. / zdlsita;
+            zdl1sita[jb] = 1. / zdlsita[jb];
         }
+    }
 
-        // ordinary Legendre polynomials from series expansion
-        // ---------------------------------------------------
+    // ordinary Legendre polynomials from series expansion
+    // ---------------------------------------------------
 
-        // even N
-        for ( int jn = 2; jn <= trc; jn += 2 ) {
-            double zdlk   = 0.5 * zfn[idxzfn( jn, 0 )];
-            double zdlldn = 0.0;
-            double zdsq   = 1. / std::sqrt( jn * ( jn + 1. ) );
-            // represented by only even k
-            for ( int jk = 2; jk <= jn; jk += 2 ) {
-                // normalised ordinary Legendre polynomial == \overbar{P_n}^0
-                zdlk = zdlk + zfn[idxzfn( jn, jk )] * vcos[jk];
-                // normalised associated Legendre polynomial == \overbar{P_n}^1
-                zdlldn = zdlldn + zdsq * zfn[idxzfn( jn, jk )] * jk * vsin[jk];
-            }
-            legpol[idxmn( 0, jn )] = zdlk;
-            legpol[idxmn( 1, jn )] = zdlldn;
+    for ( int jn = 1; jn <= trc; ++jn ) {
+        // even N is represented by only even k, odd N by only odd k
+        const int jk_begin = ( jn % 2 ) ? 1 : 2;
+        const double zdlk0 = ( jn % 2 ) ? 0. : 0.5 * zfn[idxzfn( jn, 0 )];
+        const double zdsq  = 1. / std::sqrt( jn * ( jn + 1. ) );
+        for ( size_t jb = 0; jb < nb; ++jb ) {
+            zdlk[jb]   = zdlk0;
+            zdlldn[jb] = 0.;
         }
-
-        // odd N
-        for ( int jn = 1; jn <= trc; jn += 2 ) {
-            zfn[idxzfn( jn, 0 )] = 0.;
-            double zdlk          = 0.;
-            double zdlldn        = 0.0;
-            double zdsq          = 1. / std::sqrt( jn * ( jn + 1. ) );
-            // represented by only even k
-            for ( int jk = 1; jk <= jn; jk += 2 ) {
+        for ( int jk = jk_begin; jk <= jn; jk += 2 ) {
+            const double* vcos_jk = vcos + jk * nb;
+            const double* vsin_jk = vsin + jk * nb;
+            atlas_omp_pragma( omp simd )
+            for ( size_t jb = 0; jb < nb; ++jb ) {
                 // normalised ordinary Legendre polynomial == \overbar{P_n}^0
-                zdlk = zdlk + zfn[idxzfn( jn, jk )] * vcos[jk];
+                zdlk[jb] = zdlk[jb] + zfn[idxzfn( jn, jk )] * vcos_jk[jb];
                 // normalised associated Legendre polynomial == \overbar{P_n}^1
-                zdlldn = zdlldn + zdsq * zfn[idxzfn( jn, jk )] * jk * vsin[jk];
+                zdlldn[jb] = zdlldn[jb] + zdsq * zfn[idxzfn( jn, jk )] * jk * vsin_jk[jb];
             }
-            legpol[idxmn( 0, jn )] = zdlk;
-            legpol[idxmn( 1, jn )] = zdlldn;
         }
+        for ( size_t jb = 0; jb < nb; ++jb ) {
+            legpol[idxmn( 0, jn ) + jb] = zdlk[jb];
+            legpol[idxmn( 1, jn ) + jb] = zdlldn[jb];
+        }
+    }
 
-        // --------------------------------------------------------------
-        // 2. Diagonal (the terms 0,0 and 1,1 have already been computed)
-        //    Belousov, equation (23)
-        // --------------------------------------------------------------
+    // --------------------------------------------------------------
+    // 2. Diagonal (the terms 0,0 and 1,1 have already been computed)
+    //    Belousov, equation (23)
+    // --------------------------------------------------------------
 
-        double zdls = zdl1sita * std::numeric_limits<double>::min();
-        for ( int jn = 2; jn <= trc; ++jn ) {
-            double sq = std::sqrt( ( 2. * jn + 1. ) / ( 2. * jn ) );
+    for ( int jn = 2; jn <= trc; ++jn ) {
+        double sq = std::sqrt( ( 2. * jn + 1. ) / ( 2. * jn ) );
+        for ( size_t jb = 0; jb < nb; ++jb ) {
+            double zdls = zdl1sita[jb] * std::numeric_limits<double>::min();
 
-            legpol[idxmn( jn, jn )] = legpol[idxmn( jn - 1, jn - 1 )] * zdlsita * sq;
-            if ( std::abs( legpol[idxmn( jn, jn )] ) < zdls ) {
-                legpol[idxmn( jn, jn )] = 0.0;
+            legpol[idxmn( jn, jn ) + jb] = legpol[idxmn( jn - 1, jn - 1 ) + jb] * zdlsita[jb] * sq;
+            if ( std::abs( legpol[idxmn( jn, jn ) + jb] ) < zdls ) {
+                legpol[idxmn( jn, jn ) + jb] = 0.0;
             }
         }
+    }
+
+    // ---------------------------------------------
+    // 3. General recurrence (Belousov, equation 17)
+    // ---------------------------------------------
+
+    for ( int jn = 3; jn <= trc; ++jn ) {
+        for ( int jm = 2; jm < jn; ++jm ) {
+            double cn = ( ( 2. * jn + 1. ) * ( jn + jm - 3. ) * ( jn + jm - 1. ) );  // numerator of c in Belousov
+            double cd = ( ( 2. * jn - 3. ) * ( jn + jm - 2. ) * ( jn + jm ) );       // denominator of c in Belousov
+            double dn = ( ( 2. * jn + 1. ) * ( jn - jm + 1. ) * ( jn + jm - 1. ) );  // numerator of d in Belousov
+            double dd = ( ( 2. * jn - 1. ) * ( jn + jm - 2. ) * ( jn + jm ) );       // denominator of d in Belousov
+            double en = ( ( 2. * jn + 1. ) * ( jn - jm ) );                          // numerator of e in Belousov
+            double ed = ( ( 2. * jn - 1. ) * ( jn + jm ) );                          // denominator of e in Belousov
 
-        // ---------------------------------------------
-        // 3. General recurrence (Belousov, equation 17)
-        // ---------------------------------------------
-
-        for ( int jn = 3; jn <= trc; ++jn ) {
-            for ( int jm = 2; jm < jn; ++jm ) {
-                double cn = ( ( 2. * jn + 1. ) * ( jn + jm - 3. ) * ( jn + jm - 1. ) );  // numerator of c in Belousov
-                double cd = ( ( 2. * jn - 3. ) * ( jn + jm - 2. ) * ( jn + jm ) );       // denominator of c in Belousov
-                double dn = ( ( 2. * jn + 1. ) * ( jn - jm + 1. ) * ( jn + jm - 1. ) );  // numerator of d in Belousov
-                double dd = ( ( 2. * jn - 1. ) * ( jn + jm - 2. ) * ( jn + jm ) );       // denominator of d in Belousov
-                double en = ( ( 2. * jn + 1. ) * ( jn - jm ) );                          // numerator of e in Belousov
-                double ed = ( ( 2. * jn - 1. ) * ( jn + jm ) );                          // denominator of e in Belousov
-
-                legpol[idxmn( jm, jn )] = std::sqrt( cn / cd ) * legpol[idxmn( jm - 2, jn - 2 )] -
-                                          std::sqrt( dn / dd ) * legpol[idxmn( jm - 2, jn - 1 )] * zdlx +
-                                          std::sqrt( en / ed ) * legpol[idxmn( jm, jn - 1 )] * zdlx;
+            const double c = std::sqrt( cn / cd );
+            const double d = std::sqrt( dn / dd );
+            const double e = std::sqrt( en / ed );
+
+            double* p             = legpol + idxmn( jm, jn );
+            const double* p_m2_n2 = legpol + idxmn( jm - 2, jn - 2 );
+            const double* p_m2_n1 = legpol + idxmn( jm - 2, jn - 1 );
+            const double* p_m_n1  = legpol + idxmn( jm, jn - 1 );
+            atlas_omp_pragma( omp simd )
+            for ( size_t jb = 0; jb < nb; ++jb ) {
+                p[jb] = c * p_m2_n2[jb] - d * p_m2_n1[jb] * zdlx[jb] + e * p_m_n1[jb] * zdlx[jb];
             }
         }
     }
 }
 
+}  // namespace
+
+size_t compute_legendre_polynomials_lat_workspace_size( const int trc ) {
+    return workspace_size( trc, 1 );
+}
+
+void compute_legendre_polynomials_lat( const int trc,       // truncation (in)
+                                       const double lat,    // latitude in radians (in)
+                                       double legpol[],     // legendre polynomials
+                                       const double zfn[],  // (in)
+                                       double work[] ) {    // scratch space (in/out)
+    compute_legendre_polynomials_lat_block( trc, 1, &lat, legpol, zfn, work );
+}
+
+void compute_legendre_polynomials_lat( const int trc,     // truncation (in)
+                                       const double lat,  // latitude in radians (in)
+                                       double legpol[],   // legendre polynomials
+                                       const double zfn[] ) {
+    // Reuse scratch space across calls of the same thread
+    static thread_local std::vector<double> work;
+    if ( work.size() < workspace_size( trc, 1 ) ) {
+        work.resize( workspace_size( trc, 1 ) );
+    }
+    compute_legendre_polynomials_lat_block( trc, 1, &lat, legpol, zfn, work.data() );
+}
+
 
 void compute_legendre_polynomials(
     const int truncation,      // truncation (in)
@@ -162,43 +219,50 @@ void compute_legendre_polynomials(
 {
     size_t trc           = static_cast<size_t>( truncation );
     size_t legendre_size = ( trc + 2 ) * ( trc + 1 ) / 2;
-    std::vector<double> legpol( legendre_size );
     std::vector<double> zfn( ( trc + 1 ) * ( trc + 1 ) );
     auto idxmn = [&]( size_t jm, size_t jn ) { return ( 2 * trc + 3 - jm ) * jm / 2 + jn - jm; };
     compute_zfn( truncation, zfn.data() );
 
-    // Loop over latitudes:
-    for ( size_t jlat = 0; jlat < size_t( nlats ); ++jlat ) {
-        // compute legendre polynomials for current latitude:
-        compute_legendre_polynomials_lat( truncation, lats[jlat], legpol.data(), zfn.data() );
+    // Loop over blocks of latitudes:
+    const size_t nb_blocks = ( size_t( nlats ) + lat_block - 1 ) / lat_block;
+    atlas_omp_parallel {
+        std::vector<double> legpol( legendre_size * lat_block );
+        std::vector<double> work( workspace_size( truncation, lat_block ) );
+        atlas_omp_for( size_t jblock = 0; jblock < nb_blocks; ++jblock ) {
+            const size_t jlat_begin = jblock * lat_block;
+            const size_t nb         = std::min( lat_block, size_t( nlats ) - jlat_begin );
 
-        // split polynomials into symmetric and antisymmetric parts:
-        {
-            //ATLAS_TRACE( "add to global arrays" );
+            // compute legendre polynomials for current block of latitudes:
+            compute_legendre_polynomials_lat_block( truncation, nb, lats + jlat_begin, legpol.data(), zfn.data(),
+                                                    work.data() );
 
-            for ( size_t jm = 0; jm <= trc; jm++ ) {
-                size_t is1 = 0, ia1 = 0;
-                for ( size_t jn = jm; jn <= trc; jn++ ) {
-                    ( jn - jm ) % 2 ? ia1++ : is1++;
-                }
-
-                size_t is2 = 0, ia2 = 0;
-                // the choice between the following two code lines determines whether
-                // total wavenumbers are summed in an ascending or descending order.
-                // The trans library in IFS uses descending order because it should
-                // be more accurate (higher wavenumbers have smaller contributions).
-                // This also needs to be changed when splitting the spectral data in
-                // TransLocal::invtrans_uv!
-                //for ( int jn = jm; jn <= trc; jn++ ) {
-                for ( long ljn = long( trc ), ljm = long( jm ); ljn >= ljm; ljn-- ) {
-                    size_t jn = size_t( ljn );
-                    if ( ( jn - jm ) % 2 == 0 ) {
-                        size_t is   = leg_start_sym[jm] + is1 * jlat + is2++;
-                        leg_sym[is] = legpol[idxmn( jm, jn )];
+            // split polynomials into symmetric and antisymmetric parts:
+            for ( size_t jb = 0; jb < nb; ++jb ) {
+                const size_t jlat = jlat_begin + jb;
+                for ( size_t jm = 0; jm <= trc; jm++ ) {
+                    size_t is1 = 0, ia1 = 0;
+                    for ( size_t jn = jm; jn <= trc; jn++ ) {
+                        ( jn - jm ) % 2 ? ia1++ : is1++;
                     }
-                    else {
-                        size_t ia    = leg_start_asym[jm] + ia1 * jlat + ia2++;
-                        leg_asym[ia] = legpol[idxmn( jm, jn )];
+
+                    size_t is2 = 0, ia2 = 0;
+                    // the choice between the following two code lines determines whether
+                    // total wavenumbers are summed in an ascending or descending order.
+                    // The trans library in IFS uses descending order because it should
+                    // be more accurate (higher wavenumbers have smaller contributions).
+                    // This also needs to be changed when splitting the spectral data in
+                    // TransLocal::invtrans_uv!
+                    //for ( int jn = jm; jn <= trc; jn++ ) {
+                    for ( long ljn = long( trc ), ljm = long( jm ); ljn >= ljm; ljn-- ) {
+                        size_t jn = size_t( ljn );
+                        if ( ( jn - jm ) % 2 == 0 ) {
+                            size_t is   = leg_start_sym[jm] + is1 * jlat + is2++;
+                            leg_sym[is] = legpol[idxmn( jm, jn ) * nb + jb];
+                        }
+                        else {
+                            size_t ia    = leg_start_asym[jm] + ia1 * jlat + ia2++;
+                            leg_asym[ia] = legpol[idxmn( jm, jn ) * nb + jb];
+                        }
                     }
                 }
             }
@@ -214,7 +278,6 @@ void compute_legendre_polynomials_all( const int truncation,  // truncation (in)
     size_t trc           = static_cast<size_t>( truncation );
     size_t legendre_size = ( trc + 2 ) * ( trc + 1 ) / 2;
     size_t ny            = nlats;
-    std::vector<double> legpol( legendre_size );
     std::vector<double> zfn( ( trc + 1 ) * ( trc + 1 ) );
     auto idxmn  = [&]( size_t jm, size_t jn ) { return ( 2 * trc + 3 - jm ) * jm / 2 + jn - jm; };
     auto idxmnl = [&]( size_t jm, size_t jn, size_t jlat ) {
@@ -222,18 +285,29 @@ void compute_legendre_polynomials_all( const int truncation,  // truncation (in)
     };
     compute_zfn( truncation, zfn.data() );
 
-    // Loop over latitudes:
-    for ( size_t jlat = 0; jlat < ny; ++jlat ) {
-        // compute legendre polynomials for current latitude:
-        compute_legendre_polynomials_lat( truncation, lats[jlat], legpol.data(), zfn.data() );
+    // Loop over blocks of latitudes:
+    const size_t nb_blocks = ( ny + lat_block - 1 ) / lat_block;
+    atlas_omp_parallel {
+        std::vector<double> legpol( legendre_size * lat_block );
+        std::vector<double> work( workspace_size( truncation, lat_block ) );
+        atlas_omp_for( size_t jblock = 0; jblock < nb_blocks; ++jblock ) {
+            const size_t jlat_begin = jblock * lat_block;
+            const size_t nb         = std::min( lat_block, ny - jlat_begin );
 
-        for ( size_t jm = 0; jm <= trc; ++jm ) {
-            for ( size_t jn = jm; jn <= trc; ++jn ) {
-                legendre[idxmnl( jm, jn, jlat )] = legpol[idxmn( jm, jn )];
+            // compute legendre polynomials for current block of latitudes:
+            compute_legendre_polynomials_lat_block( truncation, nb, lats + jlat_begin, legpol.data(), zfn.data(),
+                                                    work.data() );
+
+            for ( size_t jb = 0; jb < nb; ++jb ) {
+                for ( size_t jm = 0; jm <= trc; ++jm ) {
+                    for ( size_t jn = jm; jn <= trc; ++jn ) {
+                        legendre[idxmnl( jm, jn, jlat_begin + jb )] = legpol[idxmn( jm, jn ) * nb + jb];
+                    }
+                }
             }
         }
     }
-}  // namespace trans
+}
 
 // --------------------------------------------------------------------------------------------------------------------
 
@@ -37,7 +37,18 @@ void compute_zfn( const int trc, double zfn[] );
 void compute_legendre_polynomials_lat( const int trc,     // truncation (in)
                                        const double lat,  // latitude in radians (in)
                                        double legpol[],   // legendre polynomials
-                                       double zfn[] );
+                                       const double zfn[] );
+
+// Number of values of scratch space required by compute_legendre_polynomials_lat with explicit workspace
+size_t compute_legendre_polynomials_lat_workspace_size( const int trc );
+
+// As above, but using caller-provided scratch space of compute_legendre_polynomials_lat_workspace_size(trc) values,
+// to be used when called repeatedly, e.g. for every point of an unstructured grid
+void compute_legendre_polynomials_lat( const int trc,       // truncation (in)
+                                       const double lat,    // latitude in radians (in)
+                                       double legpol[],     // legendre polynomials
+                                       const double zfn[],  // (in)
+                                       double work[] );     // scratch space (in/out)
 
 void compute_legendre_polynomials(
     const int trc,              // truncation (in)
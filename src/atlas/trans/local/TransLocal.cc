@@ -1255,7 +1255,9 @@ void TransLocal::invtrans_unstructured( const int truncation, const int nb_field
     double* scl_fourier_tp;
     double* fouriertp;
     double* gp_opt;
+    double* legendre_work;
     alloc_aligned( legendre, legendre_size( truncation + 1 ) );
+    alloc_aligned( legendre_work, compute_legendre_polynomials_lat_workspace_size( truncation ) );
     alloc_aligned( scl_fourier, size_fourier * ( truncation + 1 ) );
     alloc_aligned( scl_fourier_tp, size_fourier * ( truncation + 1 ) );
     alloc_aligned( fouriertp, 2 * ( truncation + 1 ) );
@@ -1267,7 +1269,7 @@ void TransLocal::invtrans_unstructured( const int truncation, const int nb_field
     for ( const PointLonLat p : grid_.lonlat() ) {
         const double lon = p.lon() * util::Constants::degreesToRadians();
         const double lat = p.lat() * util::Constants::degreesToRadians();
-        compute_legendre_polynomials_lat( truncation, lat, legendre, zfn );
+        compute_legendre_polynomials_lat( truncation, lat, legendre, zfn, legendre_work );
         // Legendre transform:
         {
             //ATLAS_TRACE( "opt Legendre dgemm" );
@@ -1325,6 +1327,7 @@ void TransLocal::invtrans_unstructured( const int truncation, const int nb_field
         ++ip;
     }
     free_aligned( legendre );
+    free_aligned( legendre_work );
     free_aligned( scl_fourier );
     free_aligned( scl_fourier_tp );
     free_aligned( fouriertp );
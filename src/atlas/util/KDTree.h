@@ -44,6 +44,13 @@ namespace util {
 ///     auto neighbours = search.closestPoints( PointLonLat{180., 45.}, k ).payloads();
 /// @endcode
 /// The variable `neighbours` is now a container of indices (the payloads) of the 4 nearest points
+///
+/// Many points can be searched at once, with results written to flat arrays, e.g. for `std::vector<PointLonLat> points`
+/// @code{.cpp}
+///     std::vector<idx_t> neighbours( points.size() * k );
+///     search.closestPoints( points.data(), points.size(), k, neighbours.data() );
+/// @endcode
+/// The 4 nearest points of points[i] are then neighbours[i*k+j] with j < k
 
 template <typename PayloadT, typename PointT = Point3>
 class KDTree : public ObjectHandle<detail::KDTreeBase<PayloadT, PointT>> {
@@ -170,6 +177,37 @@ public:
         return get()->closestPointsWithinRadius( p, radius );
     }
 
+    /// @brief Find k closest points for each of n points given as 3D cartesian points (x,y,z) or 2D lonlat points
+    /// (lon,lat)
+    /// The neighbours of points[i] are written to payloads[i*k+j] and distances[i*k+j] for j < k, sorted by
+    /// shortest distance. The distances are not written if distances is a nullptr.
+    /// The points are searched in parallel, in spatially sorted order.
+    /// @pre k <= size()
+    template <typename Point>
+    void closestPoints( const Point points[], size_t n, size_t k, Payload payloads[],
+                        double distances[] = nullptr ) const {
+        get()->closestPoints( points, n, k, payloads, distances );
+    }
+
+    /// @brief Find closest point for each of n points given as 3D cartesian points (x,y,z) or 2D lonlat points
+    /// (lon,lat)
+    /// The closest point of points[i] is written to payloads[i] and distances[i]. The distances are not written
+    /// if distances is a nullptr.
+    template <typename Point>
+    void closestPoint( const Point points[], size_t n, Payload payloads[], double distances[] = nullptr ) const {
+        get()->closestPoint( points, n, payloads, distances );
+    }
+
+    /// @brief Find all points within a distance of given radius for each of n points given as 3D cartesian points
+    /// (x,y,z) or 2D lonlat points (lon,lat)
+    /// The points found for points[i] are payloads[j] and (*distances)[j] for offsets[i] <= j < offsets[i+1].
+    /// The output containers are resized to fit.
+    template <typename Point>
+    void closestPointsWithinRadius( const Point points[], size_t n, double radius, std::vector<size_t>& offsets,
+                                    PayloadList& payloads, std::vector<double>* distances = nullptr ) const {
+        get()->closestPointsWithinRadius( points, n, radius, offsets, payloads, distances );
+    }
+
     /// @brief Return geometry used to convert (lon,lat) to (x,y,z) coordinates
     const Geometry& geometry() const { return get()->geometry(); }
 };
@@ -11,13 +11,17 @@
 #pragma once
 
 #include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
 #include <memory>
 #include <sstream>
+#include <vector>
 
 #include "atlas/library/config.h"
+#include "atlas/parallel/omp/omp.h"
 #include "atlas/projection/Projection.h"
 #include "atlas/runtime/Exception.h"
-#include "atlas/util/KDTree.h"
 #include "atlas/util/Polygon.h"
 
 #ifdef POLYGONLOCATOR_DEBUGGING
@@ -32,17 +36,20 @@ namespace util {
 ///@brief Find polygon that contains a point
 ///
 /// Construction requires a list of polygons.
-/// The implementation makes use of a KDTree that holds centroids of all polygons.
-/// Once the nearest polygon-centroids (default=4) are found, the corresponding polygons are
-/// visited in order of shortest distance, to check if the point is contained within.
+/// The implementation makes use of a uniform grid of buckets that covers the bounding boxes of all polygons.
+/// Every bucket lists the polygons whose bounding box overlaps it, so that only those polygons are visited to
+/// check if the point is contained within. Polygons are visited from highest to lowest index, so that a point
+/// on the boundary of several polygons is found in the polygon with highest index.
+/// Should none of the listed polygons contain the point, all other polygons are checked as well, so that the
+/// search is exact also for polygons with edges that extend beyond the bounding box of their vertices,
+/// such as great circle arcs of a SphericalPolygon.
 class PolygonLocator {
 public:
     /// @brief Construct PolygonLocator from shared_ptr of polygons
     PolygonLocator( const std::shared_ptr<const PolygonCoordinates::Vector> polygons,
                     const Projection& projection = Projection() ) :
         shared_polygons_( polygons ), polygons_( *shared_polygons_ ), projection_( projection ) {
-        k_ = std::min( k_, polygons_.size() );
-        buildKDTree();
+        buildBuckets();
     }
 
     /// @brief Construct PolygonLocator and move polygons inside.
@@ -50,92 +57,162 @@ public:
         shared_polygons_( std::make_shared<PolygonCoordinates::Vector>( std::move( polygons ) ) ),
         polygons_( *shared_polygons_ ),
         projection_( projection ) {
-        k_ = std::min( k_, polygons_.size() );
-        buildKDTree();
+        buildBuckets();
     }
 
     /// @brief Construct PolygonLocator using reference to polygons.
     /// !WARNING! polygons should not go out of scope before PolygonLocator
     PolygonLocator( const PolygonCoordinates::Vector& polygons, const Projection& projection = Projection() ) :
         polygons_( polygons ), projection_( projection ) {
-        k_ = std::min( k_, polygons_.size() );
-        buildKDTree();
+        buildBuckets();
     }
 
+    /// @brief find the polygons that hold the points (lon,lat), in parallel
+    ///
+    /// Both containers need random access via operator[].
     template <typename PointContainer, typename PolygonIndexContainer>
-    void operator()( const PointContainer& points, PolygonIndexContainer& index ) {
+    void operator()( const PointContainer& points, PolygonIndexContainer& index ) const {
         ATLAS_ASSERT( points.size() == index.size() );
-        typename PointContainer::const_iterator p     = points.begin();
-        typename PointContainer::const_iterator p_end = points.end();
-        typename PolygonIndexContainer::iterator i    = index.begin();
-        for ( ; p != p_end; ++p, ++i ) {
-            *i = this->operator()( *p );
+        const size_t size = points.size();
+        atlas_omp_parallel_for( size_t n = 0; n < size; ++n ) { index[n] = find( points[n] ); }
+        for ( size_t n = 0; n < size; ++n ) {
+            if ( index[n] < 0 ) {
+                throw_NotFound( points[n] );
+            }
         }
     }
 
     /// @brief find the polygon that holds the point (lon,lat)
     idx_t operator()( const Point2& point ) const {
-        const auto found = kdtree_.closestPoints( point, k_ );
-        idx_t partition{-1};
-        for ( size_t i = 0; i < found.size(); ++i ) {
-            idx_t ii = found[i].payload();
+        const idx_t partition = find( point );
+        if ( partition < 0 ) {
+            throw_NotFound( point );
+        }
+        return partition;
+    }
+
+private:
+    idx_t find( const Point2& point ) const {
+        const Point2 xy = lonlat2xy( point );
+
+        const size_t b = bucket( xy );
+        for ( size_t k = bucket_offsets_[b + 1]; k > bucket_offsets_[b]; --k ) {
+            const idx_t ii = bucket_polygons_[k - 1];
 #ifdef POLYGONLOCATOR_DEBUGGING
-            Log::info() << "Search point " << lonlat2xy( point ) << " in polygon " << ii << ": ";
+            Log::info() << "Search point " << xy << " in polygon " << ii << ": ";
             polygons_[ii].print( Log::info() );
-            Log::info() << " ... ";
+            Log::info() << " ... " << ( polygons_[ii].contains( xy ) ? "FOUND" : "NOT_FOUND" ) << std::endl;
 #endif
-            if ( polygons_[ii].contains( lonlat2xy( point ) ) ) {
-                partition = ii;
-#ifdef POLYGONLOCATOR_DEBUGGING
-                Log::info() << "FOUND" << std::endl;
-#endif
-                break;
+            if ( polygons_[ii].contains( xy ) ) {
+                return ii;
             }
-#ifdef POLYGONLOCATOR_DEBUGGING
-            Log::info() << "NOT_FOUND" << std::endl;
-#endif
         }
-        if ( partition < 0 ) {
-            std::stringstream out;
-            out << "Could not find find point {lon,lat} = " << point << " in `k=" << k_ << "` \"nearest\" polygons [";
-            for ( size_t i = 0; i < found.size(); ++i ) {
-                if ( i > 0 ) {
-                    out << ", ";
-                }
-                out << found[i].payload();
+
+        // Not in any polygon listed in the bucket: check the remaining polygons
+        auto listed = [&]( idx_t ii ) {
+            return std::binary_search( bucket_polygons_.begin() + bucket_offsets_[b],
+                                       bucket_polygons_.begin() + bucket_offsets_[b + 1], ii );
+        };
+        for ( idx_t ii = polygons_.size() - 1; ii >= 0; --ii ) {
+            if ( not listed( ii ) && polygons_[ii].contains( xy ) ) {
+                return ii;
             }
-            out << "]. Increase `k`?";
-            throw_AssertionFailed( out.str(), Here() );
         }
-        return partition;
+        return -1;
     }
 
-private:
-    void buildKDTree() {
-        kdtree_.reserve( polygons_.size() );
-        for ( idx_t p = 0; p < polygons_.size(); ++p ) {
-            kdtree_.insert( xy2lonlat( polygons_[p].centroid() ), p );
+    [[noreturn]] void throw_NotFound( const Point2& point ) const {
+        std::stringstream out;
+        out << "Could not find point {lon,lat} = " << point << " in any of the " << polygons_.size()
+            << " polygons";
+        throw_AssertionFailed( out.str(), Here() );
+    }
+
+    void buildBuckets() {
+        const idx_t nb_polygons = polygons_.size();
+        xmin_                   = std::numeric_limits<double>::max();
+        ymin_                   = std::numeric_limits<double>::max();
+        double xmax             = std::numeric_limits<double>::lowest();
+        double ymax             = std::numeric_limits<double>::lowest();
+        for ( idx_t p = 0; p < nb_polygons; ++p ) {
+            xmin_ = std::min( xmin_, polygons_[p].coordinatesMin()[0] );
+            ymin_ = std::min( ymin_, polygons_[p].coordinatesMin()[1] );
+            xmax  = std::max( xmax, polygons_[p].coordinatesMax()[0] );
+            ymax  = std::max( ymax, polygons_[p].coordinatesMax()[1] );
+        }
+        const double width  = nb_polygons ? xmax - xmin_ : 0.;
+        const double height = nb_polygons ? ymax - ymin_ : 0.;
+
+        // About 4 buckets per polygon, with aspect ratio of the buckets close to 1
+        const double nb_buckets = 4. * std::max<idx_t>( nb_polygons, 1 );
+        if ( width > 0. && height > 0. ) {
+            nx_ = std::max<size_t>( 1, size_t( std::round( std::sqrt( nb_buckets * width / height ) ) ) );
+            ny_ = std::max<size_t>( 1, size_t( std::round( nb_buckets / double( nx_ ) ) ) );
+        }
+        else {
+            nx_ = width > 0. ? size_t( nb_buckets ) : 1;
+            ny_ = height > 0. ? size_t( nb_buckets ) : 1;
+        }
+        dx_ = width > 0. ? double( nx_ ) / width : 0.;
+        dy_ = height > 0. ? double( ny_ ) / height : 0.;
+
+        // Compressed storage of the polygons overlapping each bucket, in increasing order of index
+        auto for_each_bucket = [&]( idx_t p, const std::function<void( size_t )>& f ) {
+            const Point2 min = polygons_[p].coordinatesMin();
+            const Point2 max = polygons_[p].coordinatesMax();
+            const size_t i0  = bucket_x( min[0] );
+            const size_t i1  = bucket_x( max[0] );
+            const size_t j0  = bucket_y( min[1] );
+            const size_t j1  = bucket_y( max[1] );
+            for ( size_t j = j0; j <= j1; ++j ) {
+                for ( size_t i = i0; i <= i1; ++i ) {
+                    f( j * nx_ + i );
+                }
+            }
+        };
+        bucket_offsets_.assign( nx_ * ny_ + 1, 0 );
+        for ( idx_t p = 0; p < nb_polygons; ++p ) {
+            for_each_bucket( p, [&]( size_t b ) { ++bucket_offsets_[b + 1]; } );
         }
-        kdtree_.build();
+        for ( size_t b = 0; b < nx_ * ny_; ++b ) {
+            bucket_offsets_[b + 1] += bucket_offsets_[b];
+        }
+        bucket_polygons_.resize( bucket_offsets_.back() );
+        std::vector<size_t> position( bucket_offsets_.begin(), bucket_offsets_.end() - 1 );
+        for ( idx_t p = 0; p < nb_polygons; ++p ) {
+            for_each_bucket( p, [&]( size_t b ) { bucket_polygons_[position[b]++] = p; } );
+        }
+    }
+
+    size_t bucket_x( double x ) const {
+        const double i = std::floor( ( x - xmin_ ) * dx_ );
+        return i <= 0. ? 0 : std::min( size_t( i ), nx_ - 1 );
     }
+    size_t bucket_y( double y ) const {
+        const double j = std::floor( ( y - ymin_ ) * dy_ );
+        return j <= 0. ? 0 : std::min( size_t( j ), ny_ - 1 );
+    }
+    size_t bucket( const Point2& xy ) const { return bucket_y( xy[1] ) * nx_ + bucket_x( xy[0] ); }
 
     Point2 lonlat2xy( const Point2& lonlat ) const {
         Point2 xy{lonlat};
         projection_.lonlat2xy( xy.data() );
         return xy;
     }
-    Point2 xy2lonlat( const Point2& xy ) const {
-        Point2 lonlat{xy};
-        projection_.xy2lonlat( lonlat.data() );
-        return lonlat;
-    }
-
 
     std::shared_ptr<const PolygonCoordinates::Vector> shared_polygons_;
     const PolygonCoordinates::Vector& polygons_;
     Projection projection_;
-    idx_t k_{4};
-    IndexKDTree kdtree_;
+
+    // Uniform grid of nx_ * ny_ buckets, with origin (xmin_,ymin_) and inverse spacing (dx_,dy_)
+    size_t nx_;
+    size_t ny_;
+    double xmin_;
+    double ymin_;
+    double dx_;
+    double dy_;
+    std::vector<size_t> bucket_offsets_;
+    std::vector<idx_t> bucket_polygons_;
 };
 
 //------------------------------------------------------------------------------------------------------
@@ -150,6 +150,30 @@ bool PolygonXY::contains( const Point2& P ) const {
     return wn != 0;
 }
 
+bool PolygonXY::xrange( double y, double& xmin, double& xmax ) const {
+    if ( y < coordinatesMin_[LAT] || coordinatesMax_[LAT] < y ) {
+        return false;
+    }
+    xmin = std::numeric_limits<double>::max();
+    xmax = std::numeric_limits<double>::lowest();
+    for ( size_t i = 1; i < coordinates_.size(); ++i ) {
+        const Point2& A = coordinates_[i - 1];
+        const Point2& B = coordinates_[i];
+        if ( std::min( A[LAT], B[LAT] ) <= y && y <= std::max( A[LAT], B[LAT] ) ) {
+            if ( A[LAT] == B[LAT] ) {
+                xmin = std::min( xmin, std::min( A[LON], B[LON] ) );
+                xmax = std::max( xmax, std::max( A[LON], B[LON] ) );
+            }
+            else {
+                const double x = A[LON] + ( y - A[LAT] ) * ( B[LON] - A[LON] ) / ( B[LAT] - A[LAT] );
+                xmin           = std::min( xmin, x );
+                xmax           = std::max( xmax, x );
+            }
+        }
+    }
+    return xmin <= xmax;
+}
+
 //------------------------------------------------------------------------------------------------------
 
 }  // namespace util
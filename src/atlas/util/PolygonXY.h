@@ -36,6 +36,10 @@ public:
     /// @return if point (x,y) is in polygon
     bool contains( const Point2& Pxy ) const override;
 
+    /// @brief Range of x where the polygon boundary crosses the horizontal line at given y
+    /// @return false if the line does not cross the polygon
+    bool xrange( double y, double& xmin, double& xmax ) const;
+
 private:
     PointLonLat centroid_;
     double inner_radius_squared_{0};
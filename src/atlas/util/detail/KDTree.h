@@ -10,12 +10,21 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <exception>
 #include <iosfwd>
+#include <limits>
 #include <memory>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "eckit/container/KDTree.h"
 
 #include "atlas/library/config.h"
+#include "atlas/parallel/omp/omp.h"
 #include "atlas/runtime/Exception.h"
 #include "atlas/runtime/Log.h"
 #include "atlas/util/Geometry.h"
@@ -215,7 +224,149 @@ public:
         return do_closestPointsWithinRadius( p, radius );
     }
 
+    /// @brief Find k nearest neighbours for each of n points given as 3D cartesian points (x,y,z) or 2D lonlat
+    /// points (lon,lat)
+    /// The neighbours of points[i] are written to payloads[i*k+j] and distances[i*k+j] for j < k, sorted by
+    /// shortest distance. The distances are not written if distances is a nullptr.
+    /// The points are searched in parallel, in spatially sorted order.
+    /// @pre k <= size()
+    template <typename Point>
+    void closestPoints( const Point points[], size_t n, size_t k, Payload payloads[],
+                        double distances[] = nullptr ) const {
+        ATLAS_ASSERT( k <= static_cast<size_t>( size() ) );
+        search_in_parallel( spatial_order( points, n ), "KDTree::closestPoints", [&]( size_t i ) {
+            const auto values = do_closestPoints( points[i], k );
+            ATLAS_ASSERT( values.size() == k );
+            for ( size_t j = 0; j < k; ++j ) {
+                payloads[i * k + j] = values[j].payload();
+                if ( distances ) {
+                    distances[i * k + j] = values[j].distance();
+                }
+            }
+        } );
+    }
+
+    /// @brief Find nearest neighbour for each of n points given as 3D cartesian points (x,y,z) or 2D lonlat
+    /// points (lon,lat)
+    /// The nearest neighbour of points[i] is written to payloads[i] and distances[i]. The distances are not
+    /// written if distances is a nullptr.
+    /// The points are searched in parallel, in spatially sorted order.
+    template <typename Point>
+    void closestPoint( const Point points[], size_t n, Payload payloads[], double distances[] = nullptr ) const {
+        search_in_parallel( spatial_order( points, n ), "KDTree::closestPoint", [&]( size_t i ) {
+            const auto value = do_closestPoint( points[i] );
+            payloads[i]      = value.payload();
+            if ( distances ) {
+                distances[i] = value.distance();
+            }
+        } );
+    }
+
+    /// @brief Find all points within a distance of given radius for each of n points given as 3D cartesian points
+    /// (x,y,z) or 2D lonlat points (lon,lat)
+    /// The neighbours of points[i] are written to payloads[j] and distances[j] for offsets[i] <= j < offsets[i+1],
+    /// sorted by shortest distance. The output containers are resized to fit, and the distances are not written if
+    /// distances is a nullptr.
+    /// The points are searched in parallel, in spatially sorted order.
+    template <typename Point>
+    void closestPointsWithinRadius( const Point points[], size_t n, double radius, std::vector<size_t>& offsets,
+                                    PayloadList& payloads, std::vector<double>* distances = nullptr ) const {
+        std::vector<std::vector<Value>> values( n );
+        search_in_parallel( spatial_order( points, n ), "KDTree::closestPointsWithinRadius",
+                            [&]( size_t i ) { values[i] = do_closestPointsWithinRadius( points[i], radius ); } );
+        offsets.resize( n + 1 );
+        offsets[0] = 0;
+        for ( size_t i = 0; i < n; ++i ) {
+            offsets[i + 1] = offsets[i] + values[i].size();
+        }
+        payloads.resize( offsets[n] );
+        if ( distances ) {
+            distances->resize( offsets[n] );
+        }
+        atlas_omp_parallel_for( size_t i = 0; i < n; ++i ) {
+            for ( size_t j = 0; j < values[i].size(); ++j ) {
+                payloads[offsets[i] + j] = values[i][j].payload();
+                if ( distances ) {
+                    ( *distances )[offsets[i] + j] = values[i][j].distance();
+                }
+            }
+            std::vector<Value>().swap( values[i] );
+        }
+    }
+
+    /// @brief Order in which to search given points, such that consecutive searches are close in space and visit
+    /// mostly the same branches of the tree
+    /// Points are sorted along a Z-order (Morton) curve through their bounding box.
+    template <typename Point>
+    std::vector<size_t> spatial_order( const Point points[], size_t n ) const {
+        constexpr size_t DIMS = KDTreeTraits::Point::DIMS;
+        std::vector<std::pair<uint64_t, size_t>> keys( n );
+        std::array<double, DIMS> min, max;
+        min.fill( std::numeric_limits<double>::max() );
+        max.fill( std::numeric_limits<double>::lowest() );
+        std::vector<typename KDTreeTraits::Point> search_points( n );
+        for ( size_t i = 0; i < n; ++i ) {
+            search_points[i] = to_Point( points[i] );
+            for ( size_t d = 0; d < DIMS; ++d ) {
+                min[d] = std::min( min[d], search_points[i][d] );
+                max[d] = std::max( max[d], search_points[i][d] );
+            }
+        }
+        // Spread the lowest 21 bits of x such that they are interleaved with two zero bits
+        auto spread = []( uint64_t x ) {
+            x &= 0x1fffff;
+            x = ( x | x << 32 ) & 0x1f00000000ffff;
+            x = ( x | x << 16 ) & 0x1f0000ff0000ff;
+            x = ( x | x << 8 ) & 0x100f00f00f00f00f;
+            x = ( x | x << 4 ) & 0x10c30c30c30c30c3;
+            x = ( x | x << 2 ) & 0x1249249249249249;
+            return x;
+        };
+        atlas_omp_parallel_for( size_t i = 0; i < n; ++i ) {
+            uint64_t key = 0;
+            for ( size_t d = 0; d < DIMS; ++d ) {
+                const double extent = max[d] - min[d];
+                const double scaled = extent > 0. ? ( search_points[i][d] - min[d] ) / extent : 0.;
+                key |= spread( static_cast<uint64_t>( scaled * double( 0x1fffff ) ) ) << d;
+            }
+            keys[i] = {key, i};
+        }
+        std::sort( keys.begin(), keys.end() );
+        std::vector<size_t> order( n );
+        for ( size_t i = 0; i < n; ++i ) {
+            order[i] = keys[i].second;
+        }
+        return order;
+    }
+
 private:
+    /// @brief Call search( i ) for every point index i in given order, in parallel
+    /// Exceptions cannot be thrown from within the parallel region; the failure of the first point of each thread
+    /// is recorded instead, and the failure of the first point overall is thrown afterwards.
+    template <typename Search>
+    void search_in_parallel( const std::vector<size_t>& order, const char* what, const Search& search ) const {
+        const size_t n = order.size();
+        std::vector<std::pair<size_t, std::string>> thread_failure( atlas_omp_get_max_threads(), {n, ""} );
+        atlas_omp_parallel_for( size_t s = 0; s < n; ++s ) {
+            const size_t i = order[s];
+            try {
+                search( i );
+            }
+            catch ( const std::exception& e ) {
+                auto& failure = thread_failure[atlas_omp_get_thread_num()];
+                if ( i < failure.first ) {
+                    failure = {i, e.what()};
+                }
+            }
+        }
+        const auto failure = std::min_element( thread_failure.begin(), thread_failure.end() );
+        if ( failure->first < n ) {
+            throw_Exception( std::string( what ) + ": search for point " + std::to_string( failure->first ) +
+                                 " failed: " + failure->second,
+                             Here() );
+        }
+    }
+
     /// @brief Insert spherical point (lon,lat)
     /// If memory has been reserved with reserve(), insertion will be delayed until build() is called.
     void do_insert( const Point& p, const Payload& payload ) { insert( Value{p, payload} ); }
@@ -256,6 +407,15 @@ private:
         return do_closestPointsWithinRadius( make_Point( p ), radius );
     }
 
+    /// @brief Point in the coordinates of the tree, given a 3D cartesian point (x,y,z)
+    const Point& to_Point( const Point& p ) const { return p; }
+
+    /// @brief Point in the coordinates of the tree, given a 2D lonlat point (lon,lat)
+    template <typename LonLat, ENABLE_IF_3D_AND_IS_LONLAT( LonLat )>
+    Point to_Point( const LonLat& p ) const {
+        return make_Point( p );
+    }
+
     template <typename LonLat, ENABLE_IF_3D_AND_IS_LONLAT( LonLat )>
     Point make_Point( const LonLat& lonlat ) const {
         static_assert( std::is_base_of<Point2, LonLat>::value, "LonLat must be derived from Point2" );
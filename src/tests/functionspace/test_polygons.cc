@@ -224,6 +224,20 @@ CASE( "test_polygon_locator_from_shared" ) {
     EXPECT_EQ( find_partition( PointLonLat{0., -90.} ), mpi::size() - 1 );
 }
 
+CASE( "test_polygon_locator_batched" ) {
+    PolygonLocator find_partition( ListPolygonXY{functionspace().polygons()} );
+    std::vector<int> part( points().size() );
+    find_partition( points(), part );
+    check_part( part );
+    for ( size_t n = 0; n < points().size(); ++n ) {
+        EXPECT_EQ( part[n], find_partition( points()[n] ) );
+    }
+
+    std::vector<PointLonLat> outside{PointLonLat{0., 91.}};
+    std::vector<int> outside_part( outside.size() );
+    EXPECT_THROWS( find_partition( outside, outside_part ) );
+}
+
 //-----------------------------------------------------------------------------
 
 }  // namespace test
@@ -21,6 +21,7 @@
 #include "atlas/mesh/Mesh.h"
 #include "atlas/meshgenerator.h"
 #include "atlas/output/Gmsh.h"
+#include "atlas/parallel/Checksum.h"
 #include "atlas/parallel/mpi/mpi.h"
 #include "atlas/util/CoordinateEnums.h"
 #include "atlas/util/MicroDeg.h"
@@ -428,6 +429,76 @@ CASE( "test_functionspace_StructuredColumns halo exchange adjoint test 1" ) {
 }
 
 
+CASE( "test_functionspace_StructuredColumns order independent checksum" ) {
+    Grid grid( "O16" );
+
+    auto compute_checksum = [&]( const grid::Partitioner& partitioner ) {
+        functionspace::StructuredColumns fs( grid, partitioner, option::halo( 1 ) );
+        auto part       = array::make_view<int, 1>( fs.partition() );
+        auto remote_idx = array::make_view<idx_t, 1>( fs.remote_index() );
+        auto glb_idx    = array::make_view<gidx_t, 1>( fs.global_index() );
+
+        Field field = fs.createField<double>( option::variables( 2 ) );
+        auto value  = array::make_view<double, 2>( field );
+        for ( idx_t n = 0; n < fs.size(); ++n ) {
+            value( n, 0 ) = 0.5 * glb_idx( n );
+            value( n, 1 ) = -1. * glb_idx( n );
+        }
+
+        parallel::Checksum checksum;
+        checksum.setup( part.data(), remote_idx.data(), 0, glb_idx.data(), fs.sizeOwned() );
+        checksum.order_independent( true );
+        return checksum.execute( value.data(), 2 );
+    };
+
+    std::string checksum_equal_regions = compute_checksum( grid::Partitioner( "equal_regions" ) );
+    std::string checksum_checkerboard  = compute_checksum( grid::Partitioner( "checkerboard" ) );
+    Log::info() << "order independent checksum = " << checksum_equal_regions << std::endl;
+    EXPECT_EQ( checksum_equal_regions, checksum_checkerboard );
+}
+
+
+CASE( "test_functionspace_StructuredColumns gather FieldSet on multiple roots" ) {
+    Grid grid( "O16" );
+    functionspace::StructuredColumns fs( grid, option::halo( 1 ) | option::levels( 3 ) );
+    auto glb_idx = array::make_view<gidx_t, 1>( fs.global_index() );
+
+    const idx_t nb_fields = 7;
+    FieldSet local_fields;
+    FieldSet global_fields;
+    for ( idx_t jfield = 0; jfield < nb_fields; ++jfield ) {
+        const idx_t owner      = jfield % mpi::comm().size();
+        const std::string name = "f" + std::to_string( jfield );
+        Field local            = local_fields.add( fs.createField<double>( option::name( name ) ) );
+        global_fields.add( fs.createField<double>( option::name( name ) | option::global( owner ) ) );
+        auto value = array::make_view<double, 2>( local );
+        for ( idx_t n = 0; n < fs.size(); ++n ) {
+            for ( idx_t k = 0; k < fs.levels(); ++k ) {
+                value( n, k ) = 100. * jfield + 10. * k + glb_idx( n );
+            }
+        }
+    }
+
+    fs.gather( local_fields, global_fields );
+
+    for ( idx_t jfield = 0; jfield < nb_fields; ++jfield ) {
+        const idx_t owner = jfield % mpi::comm().size();
+        auto value        = array::make_view<double, 2>( global_fields[jfield] );
+        if ( mpi::comm().rank() == owner ) {
+            EXPECT_EQ( value.shape( 0 ), grid.size() );
+            for ( idx_t n = 0; n < value.shape( 0 ); ++n ) {
+                for ( idx_t k = 0; k < value.shape( 1 ); ++k ) {
+                    EXPECT_EQ( value( n, k ), 100. * jfield + 10. * k + ( n + 1 ) );
+                }
+            }
+        }
+        else {
+            EXPECT_EQ( value.shape( 0 ), 0 );
+        }
+    }
+}
+
+
 CASE( "create_aligned_field" ) {
     std::string gridname = eckit::Resource<std::string>( "--grid", "S20x3" );
     Grid grid( gridname );
@@ -18,7 +18,10 @@
 #include "atlas/functionspace.h"
 #include "atlas/grid.h"
 #include "atlas/grid/detail/distribution/BandsDistribution.h"
+#include "atlas/grid/detail/distribution/DistributionArray.h"
+#include "atlas/grid/detail/distribution/DistributionIntervals.h"
 #include "atlas/grid/detail/distribution/SerialDistribution.h"
+#include "atlas/grid/detail/partitioner/Partitioner.h"
 #include "atlas/parallel/mpi/mpi.h"
 #include "atlas/parallel/omp/omp.h"
 #include "atlas/util/Config.h"
@@ -139,6 +142,99 @@ CASE( "test_regular_bands" ) {
     }
 }
 
+CASE( "test_equal_regions_intervals" ) {
+    auto grid = StructuredGrid( "O32" );
+
+    grid::Partitioner partitioner( "equal_regions" );
+    grid::Distribution intervals( grid, partitioner );
+    EXPECT( dynamic_cast<const grid::detail::distribution::DistributionIntervals*>( intervals.get() ) );
+
+    grid::detail::distribution::DistributionArray array( grid, partitioner );
+
+    EXPECT( intervals.footprint() < array.footprint() );
+    EXPECT( intervals.nb_pts() == array.nb_pts() );
+    EXPECT_EQ( intervals.type(), array.type() );
+
+    for ( gidx_t n = 0; n < grid.size(); ++n ) {
+        EXPECT_EQ( intervals.partition( n ), array.partition( n ) );
+    }
+
+    gidx_t n = 0;
+    grid::Distribution::partition_t part( grid.nxmax() );
+    for ( idx_t j = 0; j < grid.ny(); ++j ) {
+        intervals.partition( n, n + grid.nx( j ), part );
+        for ( idx_t i = 0; i < grid.nx( j ); ++i, ++n ) {
+            EXPECT_EQ( part[i], array.partition( n ) );
+        }
+    }
+}
+
+CASE( "test_partitioner_intervals" ) {
+    // Intervals computed directly by the partitioners, compared to the partition array they fill
+    auto check = [&]( const Grid& grid, const grid::Partitioner& partitioner ) {
+        grid::Distribution intervals( grid, partitioner );
+        EXPECT( dynamic_cast<const grid::detail::distribution::DistributionIntervals*>( intervals.get() ) );
+        grid::detail::distribution::DistributionArray array( grid, partitioner );
+        EXPECT( intervals.nb_pts() == array.nb_pts() );
+        EXPECT_EQ( intervals.max_pts(), array.max_pts() );
+        EXPECT_EQ( intervals.min_pts(), array.min_pts() );
+        for ( gidx_t n = 0; n < grid.size(); ++n ) {
+            EXPECT_EQ( intervals.partition( n ), array.partition( n ) );
+        }
+#ifndef NDEBUG
+        EXPECT_THROWS( intervals.partition( grid.size() ) );
+        EXPECT_THROWS( intervals.partition( -1 ) );
+#endif
+    };
+    SECTION( "equal_regions" ) {
+        for ( int N : {1, 2, 7, 13, 32, 100} ) {
+            check( Grid( "O32" ), grid::Partitioner( "equal_regions", N ) );
+        }
+        check( Grid( "F24" ), grid::Partitioner( "equal_regions", 11 ) );
+        check( Grid( "L48x25" ), grid::Partitioner( "equal_regions", 9 ) );
+        check( Grid( "N16" ), grid::Partitioner( "equal_regions", 5 ) );
+    }
+    SECTION( "checkerboard" ) {
+        for ( int N : {1, 4, 6, 7, 15} ) {
+            check( Grid( "L64x33" ), grid::Partitioner( "checkerboard", N ) );
+        }
+        check( Grid( "L10x7" ), grid::Partitioner( "checkerboard", 3 ) );
+    }
+}
+
+namespace {
+// Partitions every point in turn, so that no two neighbouring points share a partition
+class RoundRobinPartitioner : public grid::detail::partitioner::Partitioner {
+public:
+    RoundRobinPartitioner( idx_t N ) : Partitioner( N ) {}
+    void partition( const Grid& grid, int part[] ) const override {
+        for ( gidx_t n = 0; n < grid.size(); ++n ) {
+            part[n] = static_cast<int>( n % nb_partitions() );
+        }
+    }
+    std::string type() const override { return "round_robin"; }
+};
+}  // namespace
+
+CASE( "test_fragmented_partition_stays_array" ) {
+    auto grid = Grid( "O16" );
+    grid::Partitioner partitioner( new RoundRobinPartitioner( 4 ) );
+    grid::Distribution distribution( grid, partitioner );
+    EXPECT( dynamic_cast<const grid::detail::distribution::DistributionArray*>( distribution.get() ) );
+    EXPECT_EQ( distribution.type(), "round_robin" );
+    for ( gidx_t n = 0; n < grid.size(); ++n ) {
+        EXPECT_EQ( distribution.partition( n ), static_cast<int>( n % 4 ) );
+    }
+}
+
+CASE( "test_empty_intervals" ) {
+    grid::detail::distribution::DistributionIntervals intervals( 0, 0, nullptr );
+    EXPECT_EQ( intervals.nb_partitions(), 0 );
+    EXPECT_EQ( intervals.size(), 0 );
+    EXPECT_EQ( intervals.max_pts(), 0 );
+    EXPECT_EQ( intervals.min_pts(), 0 );
+}
+
 CASE( "test regular_bands performance test" ) {
     // auto grid = StructuredGrid( "L40000x20000" );  //-- > test takes too long( less than 15 seconds )
     // Example timings for L40000x20000:
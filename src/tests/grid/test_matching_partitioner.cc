@@ -0,0 +1,103 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "atlas/functionspace/StructuredColumns.h"
+#include "atlas/grid/Iterator.h"
+#include "atlas/grid/Partitioner.h"
+#include "atlas/grid/StructuredGrid.h"
+#include "atlas/grid/UnstructuredGrid.h"
+#include "atlas/mesh/Mesh.h"
+#include "atlas/meshgenerator.h"
+#include "atlas/option.h"
+#include "atlas/parallel/mpi/mpi.h"
+
+#include "tests/AtlasTestEnvironment.h"
+
+namespace atlas {
+namespace test {
+
+//-----------------------------------------------------------------------------
+
+namespace {
+
+// The matching partitioners test only candidate points of structured grids, and sweep all points of unstructured
+// grids. The same points given as an unstructured grid therefore give the reference partitioning.
+std::vector<int> partition( const grid::Partitioner& partitioner, const Grid& grid ) {
+    std::vector<int> part( grid.size() );
+    partitioner.partition( grid, part.data() );
+    return part;
+}
+
+std::vector<int> partition_full_sweep( const grid::Partitioner& partitioner, const Grid& grid ) {
+    std::vector<PointXY> points;
+    points.reserve( grid.size() );
+    for ( const PointXY& p : grid.xy() ) {
+        points.emplace_back( p );
+    }
+    return partition( partitioner, UnstructuredGrid( std::move( points ) ) );
+}
+
+// Target grids with and without rows at the poles, all with rows between the poles and the first latitudes of the
+// source grid
+std::vector<std::string> target_grids() {
+    return {"L48x25", "O24", "F20", "S40x21"};
+}
+
+}  // namespace
+
+//-----------------------------------------------------------------------------
+
+CASE( "test_matching_mesh_partitioner_candidates" ) {
+    Mesh mesh = StructuredMeshGenerator().generate( Grid( "O32" ) );
+    for ( std::string type : {"lonlat-polygon", "spherical-polygon"} ) {
+        grid::MatchingPartitioner partitioner( mesh, option::type( type ) );
+        for ( const auto& name : target_grids() ) {
+            SECTION( type + " " + name ) {
+                StructuredGrid grid( name );
+                auto part = partition( partitioner, grid );
+                EXPECT( part == partition_full_sweep( partitioner, grid ) );
+
+                // The first partition contains the north pole, and the last partition the south pole
+                for ( idx_t j : {idx_t( 0 ), grid.ny() - 1} ) {
+                    if ( std::abs( grid.y( j ) ) == 90. ) {
+                        const int expected = grid.y( j ) > 0. ? 0 : int( mpi::size() ) - 1;
+                        for ( idx_t i = 0; i < grid.nx( j ); ++i ) {
+                            EXPECT_EQ( part[grid.index( i, j )], expected );
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+CASE( "test_matching_functionspace_partitioner_candidates" ) {
+    functionspace::StructuredColumns fs( Grid( "O32" ) );
+    grid::MatchingPartitioner partitioner( fs );
+    for ( const auto& name : target_grids() ) {
+        SECTION( name ) {
+            StructuredGrid grid( name );
+            EXPECT( partition( partitioner, grid ) == partition_full_sweep( partitioner, grid ) );
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+}  // namespace test
+}  // namespace atlas
+
+int main( int argc, char** argv ) {
+    return atlas::test::run( argc, argv );
+}
@@ -9,7 +9,10 @@
  */
 
 #include <cmath>
+#include <string>
+#include <vector>
 
+#include "eckit/filesystem/PathName.h"
 #include "eckit/log/Bytes.h"
 
 #include "atlas/array.h"
@@ -170,6 +173,99 @@ CASE( "extract cache, copy it, and pass non-owning pointer" ) {
 
 //-----------------------------------------------------------------------------
 
+CASE( "store matrix in file, and map it for use" ) {
+    Grid grid_source( "F32" );
+    Grid grid_target( "F16" );
+
+    Field field_source( "source", array::make_datatype<double>(), array::make_shape( grid_source.size() ) );
+    Field field_target( "target", array::make_datatype<double>(), array::make_shape( grid_target.size() ) );
+
+    set_field( field_source, grid_source, func );
+
+    const eckit::PathName path( "test_interpolation_finite_element_cached.mat" );
+    get_or_create_cache( grid_source, grid_target ).matrix().save( path );
+
+    auto cache = interpolation::MatrixCache( path );
+    EXPECT_EQ( cache.matrix().nonZeros(), get_or_create_cache( grid_source, grid_target ).matrix().nonZeros() );
+
+    ATLAS_TRACE_SCOPE( "Interpolate with mapped cache" ) {
+        Interpolation interpolation_using_cache( option::type( "finite-element" ), grid_source, grid_target, cache );
+        interpolation_using_cache.execute( field_source, field_target );
+    }
+
+    check_field( field_target, grid_target, func, 1.e-4 );
+}
+
+//-----------------------------------------------------------------------------
+
+CASE( "store and load matrix with matrix_cache_path" ) {
+    Grid grid_source( "F32" );
+    Grid grid_target( "F16" );
+
+    Field field_source( "source", array::make_datatype<double>(), array::make_shape( grid_source.size() ) );
+    Field field_target( "target", array::make_datatype<double>(), array::make_shape( grid_target.size() ) );
+
+    set_field( field_source, grid_source, func );
+
+    const eckit::PathName directory( "test_interpolation_finite_element_cached_matrices" );
+    auto matrix_files = [&]() {
+        std::vector<eckit::PathName> files, directories;
+        if ( directory.exists() ) {
+            directory.children( files, directories );
+        }
+        std::vector<eckit::PathName> matrices;
+        for ( const auto& file : files ) {
+            const std::string name = file.baseName();
+            if ( name.compare( 0, 7, "Matrix-" ) == 0 && name.size() > 4 &&
+                 name.compare( name.size() - 4, 4, ".mat" ) == 0 ) {
+                matrices.emplace_back( file );
+            }
+        }
+        return matrices;
+    };
+
+    // Start without the directory, so that the first pass computes and stores the matrix
+    if ( directory.exists() ) {
+        std::vector<eckit::PathName> files, directories;
+        directory.children( files, directories );
+        for ( auto& file : files ) {
+            file.unlink();
+        }
+        directory.rmdir();
+    }
+    EXPECT( not directory.exists() );
+
+    auto config = option::type( "finite-element" ) | util::Config( "matrix_cache_path", directory.asString() );
+
+    // First time the matrix is computed and stored, second time it is mapped from file
+    for ( int pass = 0; pass < 2; ++pass ) {
+        set_field( field_target, 0. );
+        Interpolation interpolation( config, grid_source, grid_target );
+        interpolation.execute( field_source, field_target );
+        check_field( field_target, grid_target, func, 1.e-4 );
+
+        EXPECT_EQ( matrix_files().size(), size_t( 1 ) );
+        interpolation::MatrixCache cache( interpolation );
+        EXPECT( cache );
+        EXPECT_EQ( cache.matrix().inSharedMemory(), pass == 1 );
+    }
+
+    // The same directory given with another path reuses the stored matrix
+    {
+        auto other_config = option::type( "finite-element" ) |
+                            util::Config( "matrix_cache_path", "./" + directory.asString() );
+        Interpolation interpolation( other_config, grid_source, grid_target );
+        EXPECT_EQ( matrix_files().size(), size_t( 1 ) );
+        EXPECT( interpolation::MatrixCache( interpolation ).matrix().inSharedMemory() );
+    }
+
+    for ( auto& file : matrix_files() ) {
+        file.unlink();
+    }
+}
+
+//-----------------------------------------------------------------------------
+
 }  // namespace test
 }  // namespace atlas
 
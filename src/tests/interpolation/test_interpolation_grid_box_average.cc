@@ -11,6 +11,7 @@
 
 #include <cmath>
 
+#include "eckit/filesystem/PathName.h"
 #include "eckit/log/Bytes.h"
 
 #include "atlas/array.h"
@@ -253,6 +254,42 @@ CASE( "test_interpolation_grid_box_average matrix with cache" ) {
     }
 }
 
+CASE( "test_interpolation_grid_box_average with k-d tree file cache" ) {
+    Grid gridA( "O32" );
+    Grid gridB( "O64" );
+
+    const eckit::PathName directory( "test_interpolation_grid_box_average_kdtree_cache" );
+    const eckit::PathName path = directory / ( "IndexKDTree-" + gridA.hash() + ".kdtree" );
+    if ( path.exists() ) {
+        path.unlink();
+    }
+
+    // Build and store the tree, then map it from file
+    for ( int pass = 0; pass < 2; ++pass ) {
+        interpolation::IndexKDTreeCache cache( gridA, directory );
+        EXPECT( path.exists() );
+        EXPECT_EQ( cache.tree().size(), static_cast<size_t>( gridA.size() ) );
+        EXPECT_EQ( cache.tree().closestPoint( PointLonLat{180., 45.} ).payload(), 760 );
+    }
+
+    Field fieldA( create_field( "A", gridA.size(), 1. ) );
+    Field fieldB( create_field( "B", gridB.size() ) );
+    Field fieldC( create_field( "C", gridB.size() ) );
+
+    auto config        = option::type( "grid-box-average" ).set( "matrix_free", false );
+    auto config_cached = option::type( "grid-box-average" )
+                             .set( "matrix_free", false )
+                             .set( "kdtree_cache_path", directory.asString() );
+    Interpolation( config, gridA, gridB ).execute( fieldA, fieldB );
+    Interpolation( config_cached, gridA, gridB ).execute( fieldA, fieldC );
+
+    auto valuesB = array::make_view<double, 1>( fieldB );
+    auto valuesC = array::make_view<double, 1>( fieldC );
+    for ( idx_t i = 0; i < valuesB.size(); ++i ) {
+        EXPECT_EQ( valuesB( i ), valuesC( i ) );
+    }
+}
+
 }  // namespace test
 }  // namespace atlas
 
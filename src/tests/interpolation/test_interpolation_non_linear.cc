@@ -12,6 +12,9 @@
 
 #include <algorithm>
 #include <limits>
+#include <vector>
+
+#include "eckit/linalg/Triplet.h"
 
 #include "atlas/array.h"
 #include "atlas/field/MissingValue.h"
@@ -132,6 +135,40 @@ CASE( "Interpolation with MissingValue" ) {
 }
 
 
+CASE( "Masked interpolation matches corrected matrix" ) {
+    // 3 rows of weights applied to 4 values, of which value 1 is missing
+    using Matrix = NonLinear::Matrix;
+    std::vector<eckit::linalg::Triplet> triplets{{0, 0, 0.5}, {0, 1, 0.3}, {0, 2, 0.2}, {1, 1, 0.6},
+                                                  {1, 3, 0.4}, {2, 2, 0.7}, {2, 3, 0.3}};
+    const Matrix W( 3, 4, triplets );
+
+    Field src( "src", array::make_datatype<double>(), array::make_shape( 4 ) );
+    src.metadata().set( "missing_value", missingValue );
+    src.metadata().set( "missing_value_type", "equals" );
+    auto values = array::make_view<double, 1>( src );
+    values.assign( {1., missingValue, 3., 4.} );
+
+    for ( std::string type : {"missing-if-all-missing", "missing-if-any-missing", "missing-if-heaviest-missing"} ) {
+        NonLinear nonLinear( type, Config() );
+
+        Field tgt( "tgt", array::make_datatype<double>(), array::make_shape( 3 ) );
+        EXPECT( nonLinear.interpolate( W, src, tgt ) );
+
+        Matrix M( W );
+        nonLinear.execute( M, src );
+        std::vector<double> expected( M.rows(), 0. );
+        for ( Matrix::const_iterator it = M.begin(); it != M.end(); ++it ) {
+            expected[it.row()] += *it * values( it.col() );
+        }
+
+        auto result = array::make_view<double, 1>( tgt );
+        for ( idx_t r = 0; r < 3; ++r ) {
+            EXPECT_APPROX_EQ( result( r ), expected[r], 1.e-12 );
+        }
+    }
+}
+
+
 }  // namespace test
 }  // namespace atlas
 
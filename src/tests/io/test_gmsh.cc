@@ -8,9 +8,18 @@
  * nor does it submit to any jurisdiction.
  */
 
+#include <array>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "atlas/array.h"
+#include "atlas/functionspace/NodeColumns.h"
 #include "atlas/mesh/Mesh.h"
+#include "atlas/mesh/Nodes.h"
 #include "atlas/output/Gmsh.h"
 #include "atlas/output/Output.h"
+#include "atlas/output/detail/GmshIO.h"
 
 #include "tests/AtlasTestEnvironment.h"
 #include "tests/TestMeshes.h"
@@ -34,6 +43,86 @@ CASE( "test_gmsh_output_2" ) {
     // gmsh.write( mesh );
 }
 
+CASE( "test_gmsh_output_binary" ) {
+    Mesh mesh = test::generate_mesh( Grid( "N32" ) );
+    functionspace::NodeColumns fs( mesh );
+    Field field = fs.createField<double>( option::name( "field" ) | option::variables( 2 ) );
+    auto view   = array::make_view<double, 2>( field );
+    for ( idx_t n = 0; n < view.shape( 0 ); ++n ) {
+        view( n, 0 ) = n;
+        view( n, 1 ) = -n;
+    }
+
+    output::Gmsh gmsh( "test_gmsh_output_binary.msh", util::Config( "binary", true ) );
+    gmsh.write( mesh );
+    gmsh.write( field );
+
+    if ( mpi::size() == 1 ) {
+        Mesh read = output::detail::GmshIO().read( "test_gmsh_output_binary.msh" );
+        EXPECT( read.nodes().size() == mesh.nodes().size() );
+    }
+}
+
+CASE( "test_gmsh_output_binary_field_values" ) {
+    if ( mpi::size() != 1 ) {
+        return;
+    }
+    Mesh mesh = test::generate_mesh( Grid( "N32" ) );
+    functionspace::NodeColumns fs( mesh );
+    Field field = fs.createField<double>( option::name( "field" ) | option::variables( 2 ) );
+    auto view   = array::make_view<double, 2>( field );
+    for ( idx_t n = 0; n < view.shape( 0 ); ++n ) {
+        view( n, 0 ) = 0.5 * n;
+        view( n, 1 ) = -0.25 * n;
+    }
+
+    output::Gmsh gmsh( "test_gmsh_output_binary_field.msh", util::Config( "binary", true ) );
+    gmsh.write( field );
+
+    // Parse the gmsh 2.2 binary file: text headers around records of an int index and the components as doubles
+    std::ifstream file( "test_gmsh_output_binary_field.msh", std::ios::binary );
+    std::string line;
+    std::getline( file, line );
+    EXPECT( line == "$MeshFormat" );
+    std::getline( file, line );
+    EXPECT( line == "2.2 1 8" );
+    int one = 0;
+    file.read( reinterpret_cast<char*>( &one ), sizeof( int ) );
+    EXPECT( one == 1 );
+    std::getline( file, line );
+    std::getline( file, line );
+    EXPECT( line == "$EndMeshFormat" );
+
+    std::getline( file, line );
+    EXPECT( line == "$NodeData" );
+    std::vector<std::string> tags( 9 );
+    for ( auto& tag : tags ) {
+        std::getline( file, tag );
+    }
+    EXPECT( tags[1] == "\"field\"" );
+    const int ncomponents = std::stoi( tags[6] );
+    const int ndata       = std::stoi( tags[7] );
+    EXPECT( ncomponents == 3 );
+    EXPECT( ndata == fs.nb_nodes() );
+
+    // Records are written in the order of the nodes
+    auto glb_idx = array::make_view<gidx_t, 1>( mesh.nodes().global_index() );
+    for ( idx_t n = 0; n < ndata; ++n ) {
+        int gidx;
+        std::array<double, 3> components;
+        file.read( reinterpret_cast<char*>( &gidx ), sizeof( int ) );
+        file.read( reinterpret_cast<char*>( components.data() ), sizeof( double ) * ncomponents );
+        EXPECT( file.good() );
+        EXPECT_EQ( static_cast<gidx_t>( gidx ), glb_idx( n ) );
+        EXPECT_EQ( components[0], view( n, 0 ) );
+        EXPECT_EQ( components[1], view( n, 1 ) );
+        EXPECT_EQ( components[2], 0. );
+    }
+    std::getline( file, line );
+    std::getline( file, line );
+    EXPECT( line == "$EndNodeData" );
+}
+
 //-----------------------------------------------------------------------------
 
 }  // namespace test
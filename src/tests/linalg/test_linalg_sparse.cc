@@ -328,6 +328,20 @@ CASE( "sparse_matrix matrix multiply (spmm)" ) {
         spmm( A, ma.view(), c.view() );
         expect_equal( c.view(), ArrayMatrix<float>( c_exp ).view() );
     }
+
+    SECTION( "sparse_matrix_multiply_batched [backend=omp]" ) {
+        ArrayMatrix<double> m1( m );
+        ArrayMatrix<double> m2( Matrix{{1.}, {2.}, {3.}} );
+        ArrayMatrix<double> c1( 3, 2 );
+        ArrayMatrix<double> c2( 3, 1 );
+        std::vector<View<const double, 2>> src{{m1.view().data(), array::make_shape( 3, 2 )},
+                                               {m2.view().data(), array::make_shape( 3, 1 )}};
+        std::vector<View<double, 2>> tgt{{c1.view().data(), array::make_shape( 3, 2 )},
+                                         {c2.view().data(), array::make_shape( 3, 1 )}};
+        sparse_matrix_multiply_batched( A, src, tgt, sparse::backend::omp() );
+        expect_equal( c1.view(), c_exp );
+        expect_equal( c2.view(), Vector{-7., 4., 6.} );
+    }
 }
 
 //----------------------------------------------------------------------------------------------------------------------
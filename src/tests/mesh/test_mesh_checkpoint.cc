@@ -0,0 +1,89 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include "eckit/filesystem/PathName.h"
+
+#include "atlas/array.h"
+#include "atlas/grid/Grid.h"
+#include "atlas/mesh/Checkpoint.h"
+#include "atlas/mesh/HybridElements.h"
+#include "atlas/mesh/Mesh.h"
+#include "atlas/mesh/Nodes.h"
+#include "atlas/mesh/actions/BuildEdges.h"
+#include "atlas/mesh/actions/BuildHalo.h"
+#include "atlas/mesh/actions/BuildParallelFields.h"
+#include "atlas/meshgenerator.h"
+
+#include "tests/AtlasTestEnvironment.h"
+
+using namespace atlas::mesh;
+
+namespace atlas {
+namespace test {
+
+//-----------------------------------------------------------------------------
+
+CASE( "test_mesh_checkpoint" ) {
+    Mesh mesh = StructuredMeshGenerator().generate( Grid( "O32" ) );
+    actions::build_parallel_fields( mesh );
+    actions::build_halo( mesh, 1 );
+    actions::build_edges( mesh );
+
+    const eckit::PathName path( "atlas_test_mesh_checkpoint" );
+    Checkpoint::write( mesh, path );
+    EXPECT( Checkpoint::path( path ).exists() );
+
+    Mesh restart = Checkpoint::read( path );
+
+    EXPECT( restart.grid().name() == "O32" );
+    EXPECT( restart.nodes().size() == mesh.nodes().size() );
+    EXPECT( restart.nodes().nb_fields() == mesh.nodes().nb_fields() );
+    EXPECT( restart.cells().size() == mesh.cells().size() );
+    EXPECT( restart.cells().nb_types() == mesh.cells().nb_types() );
+    EXPECT( restart.edges().size() == mesh.edges().size() );
+
+    auto xy           = array::make_view<double, 2>( mesh.nodes().xy() );
+    auto restart_xy   = array::make_view<double, 2>( restart.nodes().xy() );
+    auto gidx         = array::make_view<gidx_t, 1>( mesh.nodes().global_index() );
+    auto restart_gidx = array::make_view<gidx_t, 1>( restart.nodes().global_index() );
+    for ( idx_t n = 0; n < mesh.nodes().size(); ++n ) {
+        EXPECT( restart_xy( n, 0 ) == xy( n, 0 ) );
+        EXPECT( restart_xy( n, 1 ) == xy( n, 1 ) );
+        EXPECT( restart_gidx( n ) == gidx( n ) );
+    }
+
+    const auto& cell_nodes         = mesh.cells().node_connectivity();
+    const auto& restart_cell_nodes = restart.cells().node_connectivity();
+    for ( idx_t c = 0; c < mesh.cells().size(); ++c ) {
+        EXPECT( restart_cell_nodes.cols( c ) == cell_nodes.cols( c ) );
+        for ( idx_t j = 0; j < cell_nodes.cols( c ); ++j ) {
+            EXPECT( restart_cell_nodes( c, j ) == cell_nodes( c, j ) );
+        }
+    }
+
+    const auto& node_edges         = mesh.nodes().edge_connectivity();
+    const auto& restart_node_edges = restart.nodes().edge_connectivity();
+    EXPECT( restart_node_edges.rows() == node_edges.rows() );
+
+    // The restarted mesh can be extended further
+    actions::build_halo( restart, 2 );
+    EXPECT( restart.nodes().size() > mesh.nodes().size() );
+
+    Checkpoint::path( path ).unlink();
+}
+
+//-----------------------------------------------------------------------------
+
+}  // namespace test
+}  // namespace atlas
+
+int main( int argc, char** argv ) {
+    return atlas::test::run( argc, argv );
+}
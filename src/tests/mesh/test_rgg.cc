@@ -9,8 +9,11 @@
  */
 
 #include <algorithm>
+#include <cmath>
 #include <iomanip>
+#include <limits>
 #include <sstream>
+#include <vector>
 
 #include "eckit/types/FloatCompare.h"
 
@@ -31,6 +34,7 @@
 #include "atlas/parallel/mpi/mpi.h"
 #include "atlas/runtime/Log.h"
 #include "atlas/util/Config.h"
+#include "atlas/util/Constants.h"
 #include "atlas/util/CoordinateEnums.h"
 #include "atlas/util/Metadata.h"
 
@@ -204,6 +208,127 @@ CASE( "test_gaussian_latitudes" ) {
     }
 }
 
+//-----------------------------------------------------------------------------
+
+// Previous implementation of compute_gaussian_quadrature_npole_equator, which stored the Fourier coefficients of the
+// Legendre polynomials of all degrees up to 2N, and refined the latitudes serially
+namespace previous {
+
+void legpol_newton_iteration( int kn, const double pfn[], double px, double& pxn, double& pxmod ) {
+    int kodd    = kn % 2;
+    double zdlk = ( kodd == 0 ) ? 0.5 * pfn[0] : 0.;
+    double zdlldn = 0.;
+    int ik        = 1;
+    for ( int jn = 2 - kodd; jn <= kn; jn += 2 ) {
+        zdlk += pfn[ik] * std::cos( static_cast<double>( jn ) * px );
+        zdlldn -= pfn[ik] * static_cast<double>( jn ) * std::sin( static_cast<double>( jn ) * px );
+        ++ik;
+    }
+    pxmod = -zdlk / zdlldn;
+    pxn   = px + pxmod;
+}
+
+void legpol_weight( const int kn, const double pfn[], const double px, double& pw ) {
+    int kodd      = kn % 2;
+    double zdlldn = 0.;
+    int ik        = 1;
+    for ( int jn = 2 - kodd; jn <= kn; jn += 2 ) {
+        zdlldn -= pfn[ik] * static_cast<double>( jn ) * std::sin( static_cast<double>( jn ) * px );
+        ++ik;
+    }
+    pw = static_cast<double>( 2 * kn + 1 ) / ( zdlldn * zdlldn );
+}
+
+void legpol_quadrature( const int kn, const double pfn[], double& pl, double& pw ) {
+    const int itemax  = 20;
+    const double zeps = std::numeric_limits<double>::epsilon();
+    double zx         = pl;
+    double zxn        = 0.;
+    double zw         = 0.;
+    double pmod       = 0.;
+    int iflag         = 0;
+    for ( int jter = 1; jter <= itemax + 1; ++jter ) {
+        legpol_newton_iteration( kn, pfn, zx, zxn, pmod );
+        zx = zxn;
+        if ( iflag == 1 ) {
+            legpol_weight( kn, pfn, zx, zw );
+            break;
+        }
+        if ( std::abs( pmod ) <= zeps * 1000. ) {
+            iflag = 1;
+        }
+    }
+    EXPECT( iflag == 1 );
+    pl = zxn;
+    pw = zw;
+}
+
+void compute_gaussian_quadrature_npole_equator( const size_t N, double lats[], double weights[] ) {
+    for ( size_t i = 0; i < N; ++i ) {
+        double z = ( 4. * ( i + 1. ) - 1. ) * M_PI / ( 4. * 2. * N + 2. );
+        lats[i]  = ( z + 1. / ( tan( z ) * ( 8. * ( 2. * N ) * ( 2. * N ) ) ) );
+    }
+
+    int kdgl = 2 * N;
+    std::vector<double> zfn( ( kdgl + 1 ) * ( kdgl + 1 ) );
+    auto fn = [&]( int jn, int jgl ) -> double& { return zfn[jn * ( kdgl + 1 ) + jgl]; };
+
+    fn( 0, 0 ) = 2.;
+    for ( int jn = 1; jn <= kdgl; ++jn ) {
+        double zfnn = fn( 0, 0 );
+        for ( int jgl = 1; jgl <= jn; ++jgl ) {
+            zfnn *= std::sqrt( 1. - 0.25 / ( static_cast<double>( jgl * jgl ) ) );
+        }
+        int iodd    = jn % 2;
+        fn( jn, jn ) = zfnn;
+        for ( int jgl = 2; jgl <= jn - iodd; jgl += 2 ) {
+            fn( jn, jn - jgl ) = fn( jn, jn - jgl + 2 ) * static_cast<double>( ( jgl - 1 ) * ( 2 * jn - jgl + 2 ) ) /
+                                 static_cast<double>( jgl * ( 2 * jn - jgl + 1 ) );
+        }
+    }
+
+    int iodd = kdgl % 2;
+    int ik   = iodd;
+    std::vector<double> zzfn( N + 1 );
+    for ( int jgl = iodd; jgl <= kdgl; jgl += 2 ) {
+        zzfn[ik] = fn( kdgl, jgl );
+        ++ik;
+    }
+
+    for ( size_t jgl = 0; jgl < N; ++jgl ) {
+        legpol_quadrature( kdgl, zzfn.data(), lats[jgl], weights[jgl] );
+        lats[jgl] = 90. - lats[jgl] * util::Constants::radiansToDegrees();
+    }
+}
+
+}  // namespace previous
+
+CASE( "test_gaussian_quadrature_matches_previous_implementation" ) {
+    // N with and without tabulated latitudes; the second pass takes the quadrature from the cache
+    for ( size_t N : {16, 17, 100, 333, 1000} ) {
+        Log::info() << "Comparing gaussian quadrature " << N << " with previous implementation" << std::endl;
+        std::vector<double> previous_latitudes( N );
+        std::vector<double> previous_weights( N );
+        previous::compute_gaussian_quadrature_npole_equator( N, previous_latitudes.data(), previous_weights.data() );
+
+        std::vector<double> latitudes( N );
+        std::vector<double> weights( N );
+        for ( int pass = 0; pass < 2; ++pass ) {
+            grid::spacing::gaussian::gaussian_quadrature_npole_equator( N, latitudes.data(), weights.data() );
+            for ( size_t i = 0; i < N; ++i ) {
+                EXPECT( eckit::types::is_approximately_equal( latitudes[i], previous_latitudes[i], 1.e-12 ) );
+                EXPECT( eckit::types::is_approximately_equal( weights[i], previous_weights[i], 1.e-15 ) );
+            }
+        }
+
+        grid::spacing::gaussian::compute_gaussian_quadrature_npole_equator( N, latitudes.data(), weights.data() );
+        for ( size_t i = 0; i < N; ++i ) {
+            EXPECT( eckit::types::is_approximately_equal( latitudes[i], previous_latitudes[i], 1.e-12 ) );
+            EXPECT( eckit::types::is_approximately_equal( weights[i], previous_weights[i], 1.e-15 ) );
+        }
+    }
+}
+
 CASE( "test_rgg_meshgen_one_part" ) {
     Mesh m;
     util::Config default_opts;
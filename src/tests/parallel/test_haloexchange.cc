@@ -217,6 +217,96 @@ void test_rank1( Fixture& f ) {
     }
 }
 
+void test_rank1_split_phase( Fixture& f ) {
+    array::ArrayT<POD> arr( f.N, 2 );
+    array::ArrayView<POD, 2> arrv = array::make_host_view<POD, 2>( arr );
+
+    // Repeat to exercise reuse of the persistent buffers
+    for ( int iter = 0; iter < 3; ++iter ) {
+        for ( int j = 0; j < f.N; ++j ) {
+            arrv( j, 0 ) = ( size_t( f.part[j] ) != mpi::comm().rank() ? 0 : f.gidx[j] * 10 );
+            arrv( j, 1 ) = ( size_t( f.part[j] ) != mpi::comm().rank() ? 0 : f.gidx[j] * 100 );
+        }
+
+        f.halo_exchange.execute_begin<POD, 2>( arr );
+        EXPECT( f.halo_exchange.in_progress() );
+        f.halo_exchange.execute_end<POD, 2>( arr );
+        EXPECT( !f.halo_exchange.in_progress() );
+
+        switch ( mpi::comm().rank() ) {
+            case 0: {
+                POD arr_c[] = {90, 900, 10, 100, 20, 200, 30, 300, 40, 400};
+                validate<POD, 2>::apply( arrv, arr_c );
+                break;
+            }
+            case 1: {
+                POD arr_c[] = {30, 300, 40, 400, 50, 500, 60, 600, 70, 700, 80, 800};
+                validate<POD, 2>::apply( arrv, arr_c );
+                break;
+            }
+            case 2: {
+                POD arr_c[] = {50, 500, 60, 600, 70, 700, 80, 800, 90, 900, 10, 100, 20, 200};
+                validate<POD, 2>::apply( arrv, arr_c );
+                break;
+            }
+        }
+
+        // The next exchange allocates the released buffers again
+        f.halo_exchange.release_buffers();
+    }
+}
+
+void test_split_phase_errors( Fixture& f ) {
+    array::ArrayT<POD> arr2( f.N, 2 );
+    array::ArrayT<POD> arr1( f.N );
+
+    f.halo_exchange.execute_begin<POD, 2>( arr2 );
+    EXPECT_THROWS_AS( f.halo_exchange.execute<POD, 2>( arr2 ), eckit::Exception );
+    EXPECT_THROWS_AS( f.halo_exchange.execute_end<POD, 1>( arr1 ), eckit::Exception );
+
+    // The exchange that failed to end was completed, so that a new one can start
+    EXPECT( !f.halo_exchange.in_progress() );
+    f.halo_exchange.execute<POD, 2>( arr2 );
+}
+
+void test_fused( Fixture& f ) {
+    array::ArrayT<POD> arr2( f.N, 2 );
+    array::ArrayT<float> arr1( f.N );
+    array::ArrayView<POD, 2> arrv2  = array::make_host_view<POD, 2>( arr2 );
+    array::ArrayView<float, 1> arrv1 = array::make_host_view<float, 1>( arr1 );
+    for ( int j = 0; j < f.N; ++j ) {
+        arrv2( j, 0 ) = ( size_t( f.part[j] ) != mpi::comm().rank() ? 0 : f.gidx[j] * 10 );
+        arrv2( j, 1 ) = ( size_t( f.part[j] ) != mpi::comm().rank() ? 0 : f.gidx[j] * 100 );
+        arrv1( j )    = ( size_t( f.part[j] ) != mpi::comm().rank() ? 0 : f.gidx[j] );
+    }
+
+    f.halo_exchange.execute( std::vector<array::Array*>{&arr1, &arr2} );
+
+    switch ( mpi::comm().rank() ) {
+        case 0: {
+            POD arr2_c[]   = {90, 900, 10, 100, 20, 200, 30, 300, 40, 400};
+            float arr1_c[] = {9, 1, 2, 3, 4};
+            validate<POD, 2>::apply( arrv2, arr2_c );
+            validate<float, 1>::apply( arrv1, arr1_c );
+            break;
+        }
+        case 1: {
+            POD arr2_c[]   = {30, 300, 40, 400, 50, 500, 60, 600, 70, 700, 80, 800};
+            float arr1_c[] = {3, 4, 5, 6, 7, 8};
+            validate<POD, 2>::apply( arrv2, arr2_c );
+            validate<float, 1>::apply( arrv1, arr1_c );
+            break;
+        }
+        case 2: {
+            POD arr2_c[]   = {50, 500, 60, 600, 70, 700, 80, 800, 90, 900, 10, 100, 20, 200};
+            float arr1_c[] = {5, 6, 7, 8, 9, 1, 2};
+            validate<POD, 2>::apply( arrv2, arr2_c );
+            validate<float, 1>::apply( arrv1, arr1_c );
+            break;
+        }
+    }
+}
+
 void test_rank1_strided_v1( Fixture& f ) {
     // create a 2d field from the gidx data, with two components per grid point
     array::ArrayT<POD> arr_t( f.N, 2 );
@@ -687,6 +777,12 @@ CASE( "test_haloexchange" ) {
 
     SECTION( "test_rank1" ) { test_rank1( f ); }
 
+    SECTION( "test_rank1_split_phase" ) { test_rank1_split_phase( f ); }
+
+    SECTION( "test_split_phase_errors" ) { test_split_phase_errors( f ); }
+
+    SECTION( "test_fused" ) { test_fused( f ); }
+
     SECTION( "test_rank1_strided_v1" ) { test_rank1_strided_v1( f ); }
 
     SECTION( "test_rank1_strided_v2" ) { test_rank1_strided_v2( f ); }
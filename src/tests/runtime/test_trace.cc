@@ -8,8 +8,13 @@
  * nor does it submit to any jurisdiction.
  */
 
+#include <fstream>
+#include <sstream>
+
+#include "atlas/parallel/mpi/Statistics.h"
 #include "atlas/parallel/omp/omp.h"
 #include "atlas/runtime/Trace.h"
+#include "atlas/runtime/trace/Timeline.h"
 #include "tests/AtlasTestEnvironment.h"
 
 
@@ -45,14 +50,13 @@ CASE( "test trace OpenMP" ) {
         auto trace = Trace( Here(), "loop" );
         if ( ATLAS_HAVE_OMP ) {
             trace.stop();
-            if ( atlas_omp_get_thread_num() > 0 ) {
-                EXPECT( trace.elapsed() == 0. );
-            }
-            else {
-                EXPECT( trace.elapsed() != 0. );
-            }
+            EXPECT( trace.elapsed() != 0. );
         }
     }
+    std::string report = atlas::Trace::report();
+    if ( ATLAS_HAVE_TRACE && ATLAS_HAVE_OMP && atlas_omp_get_max_threads() > 1 ) {
+        EXPECT( report.find( "Timers in parallel regions" ) != std::string::npos );
+    }
 }
 
 CASE( "test barrier" ) {
@@ -118,6 +122,43 @@ CASE( "test report" ) {
     Log::info() << atlas::Trace::report() << std::endl;
 }
 
+CASE( "test report communication volume" ) {
+    std::vector<int> counts{0, 256, 0, 256};
+    EXPECT_EQ( mpi::Volume::of<double>( counts ).messages, size_t( 2 ) );
+    EXPECT_EQ( mpi::Volume::of<double>( counts ).bytes, 2 * 256 * sizeof( double ) );
+
+    for ( int i = 0; i < 2; ++i ) {
+        ATLAS_TRACE_MPI( BROADCAST, mpi::Volume( 1, 1024 ) ) {}
+    }
+    std::string report = atlas::Trace::report();
+    Log::info() << report << std::endl;
+#if ATLAS_HAVE_TRACE
+    EXPECT( report.find( "bandwidth" ) != std::string::npos );
+    EXPECT( report.find( "2.00 KiB" ) != std::string::npos );
+#endif
+}
+
+CASE( "test timeline" ) {
+    using runtime::trace::Timeline;
+    Timeline::enable( true );
+    Timeline::clear();
+    for ( int i = 0; i < 3; ++i ) {
+        ATLAS_TRACE_SCOPE( "timeline \"event\"" ) {}
+    }
+    Timeline::write( "atlas_test_trace_timeline.json" );
+    Timeline::enable( false );
+
+#if ATLAS_HAVE_TRACE
+    if ( mpi::rank() == 0 ) {
+        std::ifstream file( "atlas_test_trace_timeline.json" );
+        std::stringstream json;
+        json << file.rdbuf();
+        EXPECT( json.str().find( "\"traceEvents\"" ) != std::string::npos );
+        EXPECT( json.str().find( "timeline \\\"event\\\"" ) != std::string::npos );
+    }
+#endif
+}
+
 // --------------------------------------------------------------------------
 
 
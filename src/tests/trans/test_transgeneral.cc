@@ -9,6 +9,7 @@
  */
 
 #include <algorithm>
+#include <cmath>
 #include <iomanip>
 
 #include "atlas/array/MakeView.h"
@@ -28,6 +29,7 @@
 #include "atlas/parallel/mpi/mpi.h"
 #include "atlas/runtime/Trace.h"
 #include "atlas/trans/Trans.h"
+#include "atlas/trans/local/LegendrePolynomials.h"
 #include "atlas/trans/local/TransLocal.h"
 #include "atlas/util/Constants.h"
 #include "atlas/util/Earth.h"
@@ -1485,6 +1487,43 @@ CASE( "test_trans_fourier_truncation" ) {
 #endif
 //-----------------------------------------------------------------------------
 
+CASE( "test_legendre_block_matches_latitude" ) {
+    // Latitudes are computed in blocks; use a count that is not a multiple of the block size, including the poles
+    const int trc = 47;
+    std::vector<double> lats;
+    for ( double lat = 90.; lat >= -90.; lat -= 9. ) {
+        lats.push_back( lat * util::Constants::degreesToRadians() );
+    }
+    const size_t ny            = lats.size();
+    const size_t legendre_size = size_t( trc + 2 ) * size_t( trc + 1 ) / 2;
+    auto idxmn                 = [&]( size_t jm, size_t jn ) { return ( 2 * trc + 3 - jm ) * jm / 2 + jn - jm; };
+    auto idxmnl                = [&]( size_t jm, size_t jn, size_t jlat ) {
+        return ( 2 * trc + 3 - jm ) * jm / 2 * ny + jlat * ( trc - jm + 1 ) + jn - jm;
+    };
+
+    std::vector<double> legendre_all( legendre_size * ny );
+    trans::compute_legendre_polynomials_all( trc, int( ny ), lats.data(), legendre_all.data() );
+
+    std::vector<double> zfn( ( trc + 1 ) * ( trc + 1 ) );
+    trans::compute_zfn( trc, zfn.data() );
+    std::vector<double> legendre( legendre_size );
+    std::vector<double> legendre_work( legendre_size );
+    std::vector<double> work( trans::compute_legendre_polynomials_lat_workspace_size( trc ) );
+    for ( size_t jlat = 0; jlat < ny; ++jlat ) {
+        trans::compute_legendre_polynomials_lat( trc, lats[jlat], legendre.data(), zfn.data() );
+        trans::compute_legendre_polynomials_lat( trc, lats[jlat], legendre_work.data(), zfn.data(), work.data() );
+        for ( size_t jm = 0; jm <= size_t( trc ); ++jm ) {
+            for ( size_t jn = jm; jn <= size_t( trc ); ++jn ) {
+                // Vectorised block recurrences may round differently from the scalar path
+                EXPECT( std::abs( legendre_all[idxmnl( jm, jn, jlat )] - legendre[idxmn( jm, jn )] ) < 1.e-12 );
+                EXPECT( legendre_work[idxmn( jm, jn )] == legendre[idxmn( jm, jn )] );
+            }
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
 }  // namespace test
 }  // namespace atlas
 
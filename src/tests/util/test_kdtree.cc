@@ -265,6 +265,58 @@ CASE( "test closestPointsWithinRadius" ) {
     EXPECT_EQ( neighbours, expected_neighbours );
 }
 
+CASE( "test batched search" ) {
+    auto grid = Grid{"O16"};
+    std::vector<PointLonLat> points;
+    std::vector<PointXYZ> points_xyz;
+    for ( auto& p : grid.lonlat() ) {
+        points.emplace_back( p.lon() + 0.1, p.lat() - 0.1 );
+        points_xyz.emplace_back( make_xyz( points.back() ) );
+    }
+    const size_t n = points.size();
+    const size_t k = 4;
+
+    SECTION( "closestPoints" ) {
+        std::vector<idx_t> payloads( n * k );
+        std::vector<double> distances( n * k );
+        search().closestPoints( points.data(), n, k, payloads.data(), distances.data() );
+        for ( size_t i = 0; i < n; ++i ) {
+            auto neighbours = search().closestPoints( points[i], k );
+            for ( size_t j = 0; j < k; ++j ) {
+                EXPECT_EQ( payloads[i * k + j], neighbours[j].payload() );
+                EXPECT_EQ( distances[i * k + j], neighbours[j].distance() );
+            }
+        }
+        std::vector<idx_t> payloads_xyz( n * k );
+        search().closestPoints( points_xyz.data(), n, k, payloads_xyz.data() );
+        EXPECT_EQ( payloads_xyz, payloads );
+    }
+
+    SECTION( "closestPoint" ) {
+        std::vector<idx_t> payloads( n );
+        search().closestPoint( points.data(), n, payloads.data() );
+        for ( size_t i = 0; i < n; ++i ) {
+            EXPECT_EQ( payloads[i], search().closestPoint( points[i] ).payload() );
+        }
+    }
+
+    SECTION( "closestPointsWithinRadius" ) {
+        double km = 1000. * radius() / util::Earth::radius();
+        std::vector<size_t> offsets;
+        IndexKDTree::PayloadList payloads;
+        std::vector<double> distances;
+        search().closestPointsWithinRadius( points.data(), n, 500 * km, offsets, payloads, &distances );
+        EXPECT_EQ( offsets.size(), n + 1 );
+        EXPECT_EQ( payloads.size(), offsets.back() );
+        for ( size_t i = 0; i < n; ++i ) {
+            auto neighbours = search().closestPointsWithinRadius( points[i], 500 * km ).payloads();
+            auto batched =
+                IndexKDTree::PayloadList( payloads.begin() + offsets[i], payloads.begin() + offsets[i + 1] );
+            EXPECT_EQ( batched, neighbours );
+        }
+    }
+}
+
 CASE( "test compatibility with external eckit KDTree" ) {
     // External world
     struct ExternalKDTreeTraits {
@@ -13,6 +13,8 @@
 #include <utility>
 
 #include "atlas/util/Point.h"
+#include "atlas/util/Polygon.h"
+#include "atlas/util/PolygonXY.h"
 #include "atlas/util/SphericalPolygon.h"
 
 #include "tests/AtlasTestEnvironment.h"
@@ -59,6 +61,37 @@ CASE( "test_polygon_something" ) {
     }
 }
 
+CASE( "test_polygon_xy_xrange" ) {
+    using p = PointXY;
+
+    auto xrange_equals = []( const util::PolygonXY& poly, double y, double xmin, double xmax ) {
+        double x0, x1;
+        return poly.xrange( y, x0, x1 ) && x0 == xmin && x1 == xmax;
+    };
+
+    SECTION( "convex with horizontal edge" ) {
+        util::PolygonXY poly(
+            util::ExplicitPartitionPolygon( {p( 0, 0 ), p( 10, 0 ), p( 10, 5 ), p( 5, 10 ), p( 0, 5 ), p( 0, 0 )} ) );
+        double xmin, xmax;
+        EXPECT( not poly.xrange( -1., xmin, xmax ) );
+        EXPECT( not poly.xrange( 10.5, xmin, xmax ) );
+        EXPECT( xrange_equals( poly, 0., 0., 10. ) );   // horizontal edge
+        EXPECT( xrange_equals( poly, 2.5, 0., 10. ) );  // vertical edges
+        EXPECT( xrange_equals( poly, 5., 0., 10. ) );   // vertices
+        EXPECT( xrange_equals( poly, 7.5, 2.5, 7.5 ) );
+        EXPECT( xrange_equals( poly, 10., 5., 5. ) );  // single vertex
+    }
+
+    SECTION( "concave with horizontal edges" ) {
+        util::PolygonXY poly( util::ExplicitPartitionPolygon(
+            {p( 0, 0 ), p( 10, 0 ), p( 10, 10 ), p( 6, 10 ), p( 5, 8 ), p( 4, 10 ), p( 0, 10 ), p( 0, 0 )} ) );
+        EXPECT( xrange_equals( poly, 10., 0., 10. ) );  // two horizontal edges at the top
+        EXPECT( xrange_equals( poly, 8., 0., 10. ) );   // vertex of the notch
+        EXPECT( xrange_equals( poly, 9., 0., 10. ) );
+        EXPECT( xrange_equals( poly, 0., 0., 10. ) );
+    }
+}
+
 }  // namespace test
 }  // namespace atlas
 